@@ -26,6 +26,8 @@ endfunction()
 message( STATUS "Adding ACEtk C++ unit testing" )
 
 add_subdirectory( src/ACEtk/ContinuousEnergyTable/test )
+add_subdirectory( src/ACEtk/ReactionMatrix/test )
+add_subdirectory( src/ACEtk/Material/test )
 add_subdirectory( src/ACEtk/DosimetryTable/test )
 add_subdirectory( src/ACEtk/ThermalScatteringTable/test )
 add_subdirectory( src/ACEtk/PhotoatomicTable/test )
@@ -34,11 +36,24 @@ add_subdirectory( src/ACEtk/Table/Data/Parse/test )
 add_subdirectory( src/ACEtk/Table/Data/test )
 add_subdirectory( src/ACEtk/Table/Header/test )
 add_subdirectory( src/ACEtk/Table/Header201/test )
+add_subdirectory( src/ACEtk/Table/Summary/test )
 add_subdirectory( src/ACEtk/Table/test )
+add_subdirectory( src/ACEtk/TableReader/test )
+add_subdirectory( src/ACEtk/MappedFile/test )
+add_subdirectory( src/ACEtk/toConcatenatedFile/test )
+add_subdirectory( src/ACEtk/LineIndex/test )
+add_subdirectory( src/ACEtk/FileIndex/test )
+add_subdirectory( src/ACEtk/Library/test )
+add_subdirectory( src/ACEtk/ThreadPool/test )
+add_subdirectory( src/ACEtk/BlockSelection/test )
+add_subdirectory( src/ACEtk/BinaryIO/test )
+add_subdirectory( src/ACEtk/BinaryFormat/test )
+add_subdirectory( src/ACEtk/SnapshotFormat/test )
 
 add_subdirectory( src/ACEtk/continuous/InterpolationData/test )
 add_subdirectory( src/ACEtk/continuous/PolynomialFissionMultiplicity/test )
 add_subdirectory( src/ACEtk/continuous/PrincipalCrossSectionBlock/test )
+add_subdirectory( src/ACEtk/continuous/PrincipalCrossSectionBlock/EnergyGridIndex/test )
 add_subdirectory( src/ACEtk/continuous/ReactionNumberBlock/test )
 add_subdirectory( src/ACEtk/continuous/ReactionQValueBlock/test )
 add_subdirectory( src/ACEtk/continuous/FrameAndMultiplicityBlock/test )
@@ -126,5 +141,6 @@ add_subdirectory( src/ACEtk/thermal/InelasticAngularDistributionBlock/test )
 add_subdirectory( src/ACEtk/photonuclear/PrincipalCrossSectionBlock/test )
 add_subdirectory( src/ACEtk/photonuclear/SecondaryParticleLocatorBlock/test )
 
+add_subdirectory( src/ACEtk/Zaid/test )
 add_subdirectory( src/ACEtk/XsdirEntry/test )
 add_subdirectory( src/ACEtk/Xsdir/test )
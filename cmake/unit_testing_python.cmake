@@ -28,6 +28,7 @@ add_python_test( Header     Test_ACEtk_Header.py )
 add_python_test( Header201  Test_ACEtk_Header201.py )
 add_python_test( Data       Test_ACEtk_Data.py )
 add_python_test( Table      Test_ACEtk_Table.py )
+add_python_test( ReactionMatrix Test_ACEtk_ReactionMatrix.py )
 
 add_python_test( continuous.EnergyDistributionBlock                      continuous/Test_ACEtk_continuous_EnergyDistributionBlock.py )
 add_python_test( continuous.FissionMultiplicityBlock                     continuous/Test_ACEtk_continuous_FissionMultiplicityBlock.py )
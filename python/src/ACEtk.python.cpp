@@ -21,6 +21,7 @@ void wrapXsdir( python::module&, python::module& );
 void wrapReferenceFrame( python::module&, python::module& );
 void wrapAngularDistributionType( python::module&, python::module& );
 void wrapEnergyDistributionType( python::module&, python::module& );
+void wrapMatrixLayout( python::module&, python::module& );
 
 // declarations - block and component subpackages
 void wrapContinuous( python::module&, python::module& );
@@ -37,6 +38,9 @@ void wrapThermalScatteringTable( python::module&, python::module& );
 void wrapPhotoatomicTable( python::module&, python::module& );
 void wrapPhotonuclearTable( python::module&, python::module& );
 
+// declarations - derived data
+void wrapReactionMatrix( python::module&, python::module& );
+
 /**
  *  @brief ACEtk python bindings
  *
@@ -58,6 +62,7 @@ PYBIND11_MODULE( ACEtk, module ) {
   wrapReferenceFrame( module, viewmodule );
   wrapAngularDistributionType( module, viewmodule );
   wrapEnergyDistributionType( module, viewmodule );
+  wrapMatrixLayout( module, viewmodule );
 
   // wrap generic ACE table components
   wrapHeader( module, viewmodule );
@@ -83,4 +88,7 @@ PYBIND11_MODULE( ACEtk, module ) {
   wrapThermalScatteringTable( module, viewmodule );
   wrapPhotoatomicTable( module, viewmodule );
   wrapPhotonuclearTable( module, viewmodule );
+
+  // wrap derived data
+  wrapReactionMatrix( module, viewmodule );
 }
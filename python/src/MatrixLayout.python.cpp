@@ -0,0 +1,31 @@
+// system includes
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+// local includes
+#include "ACEtk/MatrixLayout.hpp"
+
+// namespace aliases
+namespace python = pybind11;
+
+void wrapMatrixLayout( python::module& module, python::module& ) {
+
+  // type aliases
+  using Component = njoy::ACEtk::MatrixLayout;
+
+  // wrap views created by this component
+
+  // create the component
+  python::enum_< Component > component(
+
+    module,
+    "MatrixLayout",
+    "The storage layout of a matrix",
+    python::arithmetic()
+  );
+
+  // wrap the component
+  component
+  .value( "RowMajor", Component::RowMajor )
+  .value( "ColumnMajor", Component::ColumnMajor );
+}
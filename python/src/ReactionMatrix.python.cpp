@@ -0,0 +1,123 @@
+// system includes
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+// local includes
+#include "ACEtk/ReactionMatrix.hpp"
+
+// namespace aliases
+namespace python = pybind11;
+
+void wrapReactionMatrix( python::module& module, python::module& ) {
+
+  // type aliases
+  using Component = njoy::ACEtk::ReactionMatrix< double >;
+  using ContinuousEnergyTable = njoy::ACEtk::ContinuousEnergyTable;
+  using MatrixLayout = njoy::ACEtk::MatrixLayout;
+
+  // wrap views created by this component
+
+  // create the component
+  python::class_< Component > component(
+
+    module,
+    "ReactionMatrix",
+    "A dense matrix with the reaction cross sections of a continuous energy\n"
+    "table on the energy grid of the ESZ block\n\n"
+    "The matrix has a row for each energy point of the ESZ block and a column\n"
+    "for each reaction of the SIG block (in the order of the MTR block). The\n"
+    "photon production cross sections in the SIGP block given as cross\n"
+    "sections can be added as additional columns (in the order of the MTRP\n"
+    "block).\n\n"
+    "Cross section values below the threshold and above the last energy\n"
+    "point of a reaction are zero.\n\n"
+    "The matrix supports the buffer protocol so that its values can be\n"
+    "accessed without copying them (e.g. using numpy.asarray).",
+    python::buffer_protocol()
+  );
+
+  // wrap the component
+  component
+  .def(
+
+    python::init< const ContinuousEnergyTable&, MatrixLayout, bool >(),
+    python::arg( "table" ),
+    python::arg( "layout" ) = MatrixLayout::ColumnMajor,
+    python::arg( "photon_production" ) = false,
+    "Initialise the matrix\n\n"
+    "Arguments:\n"
+    "    self                the matrix\n"
+    "    table               the continuous energy table\n"
+    "    layout              the storage layout (default: column-major)\n"
+    "    photon_production   the flag to add the photon production cross\n"
+    "                        sections (default: false)"
+  )
+  .def_property_readonly(
+
+    "layout",
+    &Component::layout,
+    "The storage layout of the matrix"
+  )
+  .def_property_readonly(
+
+    "number_rows",
+    &Component::numberRows,
+    "The number of rows (the number of energy points)"
+  )
+  .def_property_readonly(
+
+    "number_columns",
+    &Component::numberColumns,
+    "The number of columns (the number of reactions)"
+  )
+  .def_property_readonly(
+
+    "leading_dimension",
+    &Component::leadingDimension,
+    "The leading dimension of the matrix\n\n"
+    "The leading dimension is the distance between the start of two rows\n"
+    "(row-major order) or two columns (column-major order). It is the number\n"
+    "of columns or rows, padded to a multiple of the alignment."
+  )
+  .def_property_readonly(
+
+    "reaction_numbers",
+    &Component::reactionNumbers,
+    "The reaction numbers of the columns"
+  )
+  .def(
+
+    "value",
+    [] ( const Component& self, std::size_t row, std::size_t column ) {
+
+      if ( ( row >= self.numberRows() ) || ( column >= self.numberColumns() ) ) {
+
+        throw python::index_error( "the row or column index is out of range" );
+      }
+      return self( row, column );
+    },
+    python::arg( "row" ), python::arg( "column" ),
+    "Return a value of the matrix\n\n"
+    "Arguments:\n"
+    "    self      the matrix\n"
+    "    row       the row index (zero-based)\n"
+    "    column    the column index (zero-based)"
+  )
+  .def_buffer(
+
+    [] ( const Component& self ) -> python::buffer_info {
+
+      // the padding is skipped using the strides of the buffer
+      const python::ssize_t size = sizeof( double );
+      const python::ssize_t stride = self.leadingDimension() * sizeof( double );
+      return python::buffer_info(
+               const_cast< double* >( self.data() ), size,
+               python::format_descriptor< double >::format(), 2,
+               { self.numberRows(), self.numberColumns() },
+               self.layout() == MatrixLayout::RowMajor
+               ? std::vector< python::ssize_t >{ stride, size }
+               : std::vector< python::ssize_t >{ size, stride },
+               true );
+    }
+  );
+}
@@ -0,0 +1,66 @@
+# standard imports
+import os
+import unittest
+
+# third party imports
+
+# local imports
+from ACEtk import ContinuousEnergyTable
+from ACEtk import MatrixLayout
+from ACEtk import ReactionMatrix
+
+class Test_ACEtk_ReactionMatrix( unittest.TestCase ) :
+    """Unit test for the ReactionMatrix class."""
+
+    filename = os.path.join( os.path.dirname( __file__ ), '..', '..', 'src',
+                             'ACEtk', 'ContinuousEnergyTable', 'test',
+                             'resources', '2003.710nc' )
+
+    def test_component( self ) :
+
+        def verify_chunk( self, chunk, table ) :
+
+            # verify content
+            self.assertEqual( 693, chunk.number_rows )
+            self.assertEqual( 8, chunk.number_columns )
+            self.assertEqual( 8, len( chunk.reaction_numbers ) )
+
+            for index in range( 1, table.SIG.NTR + 1 ) :
+
+                column = index - 1
+                first = table.SIG.energy_index( index ) - 1
+                values = table.SIG.cross_sections( index )
+
+                self.assertEqual( table.MTR.MT( index ), chunk.reaction_numbers[column] )
+                if first > 0 :
+
+                    self.assertEqual( 0., chunk.value( first - 1, column ) )
+                self.assertAlmostEqual( values[0], chunk.value( first, column ) )
+                self.assertAlmostEqual( values[-1],
+                                        chunk.value( first + len( values ) - 1, column ) )
+
+            # verify the buffer
+            view = memoryview( chunk )
+            self.assertEqual( True, view.readonly )
+            self.assertEqual( ( 693, 8 ), view.shape )
+
+            # verify exceptions
+            with self.assertRaises( IndexError ) :
+
+                chunk.value( 693, 0 )
+
+        table = ContinuousEnergyTable.from_file( self.filename )
+
+        chunk = ReactionMatrix( table )
+        self.assertEqual( MatrixLayout.ColumnMajor, chunk.layout )
+        self.assertEqual( 696, chunk.leading_dimension )
+        verify_chunk( self, chunk, table )
+
+        chunk = ReactionMatrix( table, MatrixLayout.RowMajor )
+        self.assertEqual( MatrixLayout.RowMajor, chunk.layout )
+        self.assertEqual( 8, chunk.leading_dimension )
+        verify_chunk( self, chunk, table )
+
+if __name__ == '__main__' :
+
+    unittest.main()
@@ -1,4 +1,5 @@
 // xsdir
+#include "ACEtk/Zaid.hpp"
 #include "ACEtk/XsdirEntry.hpp"
 #include "ACEtk/Xsdir.hpp"
 
@@ -6,10 +7,26 @@
 #include "ACEtk/State.hpp"
 #include "ACEtk/Table.hpp"
 #include "ACEtk/fromFile.hpp"
+#include "ACEtk/MappedFile.hpp"
+#include "ACEtk/LineIndex.hpp"
+#include "ACEtk/FileIndex.hpp"
+#include "ACEtk/fromMappedFile.hpp"
+#include "ACEtk/peekHeader.hpp"
+#include "ACEtk/toConcatenatedFile.hpp"
+#include "ACEtk/TableReader.hpp"
+#include "ACEtk/ThreadPool.hpp"
+#include "ACEtk/BinaryFormat.hpp"
+#include "ACEtk/BinaryIO.hpp"
+#include "ACEtk/fromBinaryFile.hpp"
+#include "ACEtk/SnapshotFormat.hpp"
+#include "ACEtk/fromSnapshotFile.hpp"
+#include "ACEtk/BlockSelection.hpp"
 
 // enumerators
 #include "ACEtk/AngularDistributionType.hpp"
 #include "ACEtk/EnergyDistributionType.hpp"
+#include "ACEtk/EnergyGridScheme.hpp"
+#include "ACEtk/MatrixLayout.hpp"
 #include "ACEtk/ReferenceFrame.hpp"
 
 // ACE data blocks
@@ -25,3 +42,10 @@
 #include "ACEtk/PhotoatomicTable.hpp"
 #include "ACEtk/PhotonuclearTable.hpp"
 #include "ACEtk/ThermalScatteringTable.hpp"
+
+// derived data
+#include "ACEtk/Material.hpp"
+#include "ACEtk/ReactionMatrix.hpp"
+
+// library management
+#include "ACEtk/Library.hpp"
@@ -0,0 +1,79 @@
+#ifndef NJOY_ACETK_BINARYFORMAT
+#define NJOY_ACETK_BINARYFORMAT
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <variant>
+#include <vector>
+
+// other includes
+#include "tools/Log.hpp"
+#include "tools/overload.hpp"
+#include "ACEtk/BinaryIO.hpp"
+#include "ACEtk/Table.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief Reading and writing ACE tables in the binary (type 2) format
+ *
+ *  A binary ACE file consists of fixed length (direct access) records. A
+ *  table starts with a header record that contains (without any padding
+ *  between the fields):
+ *    - the ZAID (10 characters), the atomic weight ratio (8 byte real), the
+ *      temperature (8 byte real) and the date (10 characters)
+ *    - the title (70 characters) and the material (10 characters)
+ *    - the IZAW array as 16 pairs of a 4 byte integer and an 8 byte real
+ *    - the NXS array as 16 integers of 4 bytes
+ *    - the JXS array as 32 integers of 4 bytes
+ *
+ *  The XSS array follows in the next records, each holding a fixed number of
+ *  8 byte reals (the number of entries per record). The unused space in the
+ *  last record is filled with zeros. All values are stored in the native
+ *  byte order of the machine, as done by MCNP.
+ *
+ *  The address of a table is the record number (starting at 1) of its header
+ *  record and the record length is given in bytes.
+ */
+class BinaryFormat {
+
+  /* auxiliary functions */
+  #include "ACEtk/BinaryFormat/src/verifyRecordLayout.hpp"
+  #include "ACEtk/BinaryFormat/src/right.hpp"
+
+public:
+
+  /**
+   *  @brief Return the size of the header record content (in bytes)
+   */
+  static constexpr std::size_t headerLength() { return 500; }
+
+  /**
+   *  @brief Return the number of records required for a table
+   *
+   *  @param[in] length    the length of the XSS array
+   *  @param[in] entries   the number of entries per record
+   */
+  static constexpr std::size_t numberRecords( std::size_t length,
+                                              std::size_t entries ) {
+
+    return 1 + ( length + entries - 1 ) / entries;
+  }
+
+  #include "ACEtk/BinaryFormat/src/read.hpp"
+  #include "ACEtk/BinaryFormat/src/write.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
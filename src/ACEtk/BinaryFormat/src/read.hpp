@@ -0,0 +1,91 @@
+/**
+ *  @brief Read an ACE table from a binary stream
+ *
+ *  @param[in] in             the input stream (opened in binary mode)
+ *  @param[in] address        the record number of the header record
+ *  @param[in] recordLength   the length of a record (in bytes)
+ *  @param[in] entries        the number of XSS entries per record
+ */
+static Table read( std::istream& in, unsigned int address,
+                   unsigned int recordLength, unsigned int entries ) {
+
+  verifyRecordLayout( recordLength, entries );
+  if ( address == 0 ) {
+
+    Log::error( "The address of a table in a binary file starts at 1" );
+    throw std::exception();
+  }
+
+  // the header record
+  std::vector< char > record( recordLength );
+  in.seekg( static_cast< std::streamoff >( address - 1 ) * recordLength );
+  if ( not in.read( record.data(), recordLength ) ) {
+
+    Log::error( "Could not read the header record of a binary ACE table" );
+    Log::info( "Address: {}", address );
+    throw std::exception();
+  }
+
+  const char* position = record.data();
+  std::string zaid = BinaryIO::unpack( position, 10 );
+  double awr = BinaryIO::unpack< double >( position );
+  double temperature = BinaryIO::unpack< double >( position );
+  std::string date = BinaryIO::unpack( position, 10 );
+  std::string title = BinaryIO::unpack( position, 70 );
+  std::string material = BinaryIO::unpack( position, 10 );
+
+  std::pair< std::array< int32_t, 16 >, std::array< double, 16 > > izaw;
+  for ( unsigned int i = 0; i < 16; ++i ) {
+
+    izaw.first[i] = BinaryIO::unpack< std::int32_t >( position );
+    izaw.second[i] = BinaryIO::unpack< double >( position );
+  }
+  std::array< int64_t, 16 > nxs;
+  for ( auto& value : nxs ) {
+
+    value = BinaryIO::unpack< std::int32_t >( position );
+  }
+  std::array< int64_t, 32 > jxs;
+  for ( auto& value : jxs ) {
+
+    value = BinaryIO::unpack< std::int32_t >( position );
+  }
+
+  if ( nxs[0] < 0 ) {
+
+    Log::error( "The length of the XSS array cannot be negative" );
+    Log::info( "NXS(1): {}", nxs[0] );
+    throw std::exception();
+  }
+
+  // the XSS records: when the records are completely filled with values, the
+  // entire array is read at once
+  const std::size_t length = nxs[0];
+  std::vector< double > xss( length );
+  if ( recordLength == entries * sizeof( double ) ) {
+
+    in.read( reinterpret_cast< char* >( xss.data() ),
+             length * sizeof( double ) );
+  }
+  else {
+
+    for ( std::size_t index = 0; index < length && in; index += entries ) {
+
+      const std::size_t count = std::min< std::size_t >( entries, length - index );
+      in.read( record.data(), recordLength );
+      std::memcpy( xss.data() + index, record.data(), count * sizeof( double ) );
+    }
+  }
+
+  if ( not in ) {
+
+    Log::error( "Could not read the XSS records of a binary ACE table" );
+    Log::info( "Address: {}", address );
+    Log::info( "Length of the XSS array: {}", length );
+    throw std::exception();
+  }
+
+  return Table( Table::Header( zaid, awr, temperature, date, title, material ),
+                Table::Data( std::move( izaw ), std::move( nxs ),
+                             std::move( jxs ), std::move( xss ) ) );
+}
@@ -0,0 +1,5 @@
+static std::string right( const std::string& value, std::size_t length ) {
+
+  return value.size() < length ? std::string( length - value.size(), ' ' ) + value
+                               : value;
+}
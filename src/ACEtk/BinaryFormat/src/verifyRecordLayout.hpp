@@ -0,0 +1,20 @@
+static void verifyRecordLayout( unsigned int recordLength,
+                                unsigned int entries ) {
+
+  if ( recordLength < headerLength() ) {
+
+    Log::error( "The record length is too small for the header record" );
+    Log::info( "Record length: {}", recordLength );
+    Log::info( "Minimum record length: {}", headerLength() );
+    throw std::exception();
+  }
+
+  if ( ( entries == 0 ) || ( recordLength < entries * sizeof( double ) ) ) {
+
+    Log::error( "The number of entries per record is inconsistent with the "
+                "record length" );
+    Log::info( "Record length: {}", recordLength );
+    Log::info( "Number of entries per record: {}", entries );
+    throw std::exception();
+  }
+}
@@ -0,0 +1,124 @@
+/**
+ *  @brief Write an ACE table to a binary stream
+ *
+ *  The table is written at the current position of the stream. Since the
+ *  binary format only supports the legacy header, the title and material
+ *  of a table with a 2.0.1 style header are taken from its first comment
+ *  line (if there is one).
+ *
+ *  @param[in] table          the ACE table to be written
+ *  @param[in] out            the output stream (opened in binary mode)
+ *  @param[in] recordLength   the length of a record (in bytes)
+ *  @param[in] entries        the number of XSS entries per record
+ *
+ *  @return the number of records that were written
+ */
+static std::size_t write( const Table& table, std::ostream& out,
+                          unsigned int recordLength, unsigned int entries ) {
+
+  verifyRecordLayout( recordLength, entries );
+
+  std::string zaid, date, title, material;
+  double awr = 0., temperature = 0.;
+  std::visit( tools::overload{
+
+                [&] ( const Table::Header& header ) {
+
+                  zaid = header.ZAID();
+                  awr = header.AWR();
+                  temperature = header.TEMP();
+                  date = header.date();
+                  title = header.title();
+                  material = header.material();
+                },
+                [&] ( const Table::Header201& header ) {
+
+                  zaid = header.ZAID();
+                  awr = header.AWR();
+                  temperature = header.TEMP();
+                  date = header.date();
+                  if ( header.comments().size() > 0 ) {
+
+                    title = header.comments().front();
+                  }
+                }
+              },
+              table.header() );
+
+  if ( zaid.size() > 10 ) {
+
+    Log::error( "The ZAID of the table is too long for the binary format" );
+    Log::info( "ZAID: \'{}\'", zaid );
+    throw std::exception();
+  }
+
+  const auto& data = table.data();
+  auto fits = [] ( int64_t value ) {
+
+    return ( value >= std::numeric_limits< std::int32_t >::min() ) &&
+           ( value <= std::numeric_limits< std::int32_t >::max() );
+  };
+  if ( not ( std::all_of( data.NXS().begin(), data.NXS().end(), fits ) &&
+             std::all_of( data.JXS().begin(), data.JXS().end(), fits ) ) ) {
+
+    Log::error( "The NXS or JXS array contains values that are too large "
+                "for the binary format" );
+    throw std::exception();
+  }
+
+  // the header record
+  std::vector< char > record( recordLength, 0 );
+  char* position = record.data();
+  BinaryIO::pack( position, right( zaid, 10 ), 10 );
+  BinaryIO::pack( position, awr );
+  BinaryIO::pack( position, temperature );
+  BinaryIO::pack( position, right( date, 10 ), 10 );
+  BinaryIO::pack( position, title, 70 );
+  BinaryIO::pack( position, right( material, 10 ), 10 );
+  for ( unsigned int i = 0; i < 16; ++i ) {
+
+    BinaryIO::pack( position, static_cast< std::int32_t >( data.IZ()[i] ) );
+    BinaryIO::pack( position, data.AW()[i] );
+  }
+  for ( auto value : data.NXS() ) {
+
+    BinaryIO::pack( position, static_cast< std::int32_t >( value ) );
+  }
+  for ( auto value : data.JXS() ) {
+
+    BinaryIO::pack( position, static_cast< std::int32_t >( value ) );
+  }
+  out.write( record.data(), recordLength );
+
+  // the XSS records: when the records are completely filled with values, the
+  // entire array is written at once (followed by the unused part of the last
+  // record)
+  const auto& xss = data.XSS();
+  const std::size_t length = xss.size();
+  if ( recordLength == entries * sizeof( double ) ) {
+
+    out.write( reinterpret_cast< const char* >( xss.data() ),
+               length * sizeof( double ) );
+    std::fill( record.begin(), record.end(), 0 );
+    out.write( record.data(),
+               ( entries - length % entries ) % entries * sizeof( double ) );
+  }
+  else {
+
+    for ( std::size_t index = 0; index < length; index += entries ) {
+
+      const std::size_t count = std::min< std::size_t >( entries, length - index );
+      std::fill( record.begin(), record.end(), 0 );
+      std::memcpy( record.data(), xss.data() + index, count * sizeof( double ) );
+      out.write( record.data(), recordLength );
+    }
+  }
+
+  if ( not out ) {
+
+    Log::error( "Could not write the binary ACE table" );
+    throw std::exception();
+  }
+
+  return numberRecords( length, entries );
+}
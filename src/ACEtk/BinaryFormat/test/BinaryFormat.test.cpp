@@ -0,0 +1,262 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/BinaryFormat.hpp"
+#include "ACEtk/fromBinaryFile.hpp"
+
+// other includes
+#include <sstream>
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+std::string chunk();
+std::string chunkWith201Header();
+void verifyHeader( const Table& );
+void verifyChunk( const Table& );
+
+SCENARIO( "BinaryFormat" ) {
+
+  GIVEN( "an ACE table with a legacy header" ) {
+
+    std::string string = chunk();
+    State< std::string::iterator > state{ 1, string.begin(), string.end() };
+    Table table( state );
+
+    WHEN( "the table is written using completely filled records" ) {
+
+      std::stringstream buffer;
+      auto records = BinaryFormat::write( table, buffer, 4096, 512 );
+
+      THEN( "the records are written" ) {
+
+        CHECK( 2 == records );
+        CHECK( 2 * 4096 == buffer.str().size() );
+      } // THEN
+
+      THEN( "the table can be read again" ) {
+
+        Table read = BinaryFormat::read( buffer, 1, 4096, 512 );
+        verifyHeader( read );
+        verifyChunk( read );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the table is written using records with unused space" ) {
+
+      std::stringstream buffer;
+      auto records = BinaryFormat::write( table, buffer, 512, 4 );
+
+      THEN( "the records are written" ) {
+
+        CHECK( 3 == records );
+        CHECK( 3 * 512 == buffer.str().size() );
+        CHECK( 3 == BinaryFormat::numberRecords( 6, 4 ) );
+      } // THEN
+
+      THEN( "the table can be read again" ) {
+
+        Table read = BinaryFormat::read( buffer, 1, 512, 4 );
+        verifyHeader( read );
+        verifyChunk( read );
+      } // THEN
+    } // WHEN
+
+    WHEN( "multiple tables are written to the same stream" ) {
+
+      std::stringstream buffer;
+      auto first = BinaryFormat::write( table, buffer, 512, 4 );
+      BinaryFormat::write( table, buffer, 512, 4 );
+
+      THEN( "the second table can be read using its address" ) {
+
+        Table read = BinaryFormat::read( buffer, first + 1, 512, 4 );
+        verifyHeader( read );
+        verifyChunk( read );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the table is written to and read from a file" ) {
+
+      auto records = toBinaryFile( table, "binary.ace" );
+      Table read = fromBinaryFile( "binary.ace" );
+      Table entry = fromBinaryFile(
+                        XsdirEntry( "92238.80c", 236.0058, "binary.ace", 2, 1,
+                                    6, std::nullopt, 4096, 512 ) );
+
+      THEN( "the table can be read again" ) {
+
+        CHECK( 2 == records );
+        verifyHeader( read );
+        verifyChunk( read );
+        verifyHeader( entry );
+        verifyChunk( entry );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an ACE table with a 2.0.1 header" ) {
+
+    std::string string = chunk();
+    State< std::string::iterator > state{ 1, string.begin(), string.end() };
+    Table legacy( state );
+    Table table( Table::Header201( "92238.80c", "ENDF/B-VIII.0", 236.0058,
+                                   2.5301E-08, "2018-05-01",
+                                   { "U238 processed by NJOY", "comment" } ),
+                 Table::Data( legacy.data() ) );
+
+    WHEN( "the table is written and read again" ) {
+
+      std::stringstream buffer;
+      BinaryFormat::write( table, buffer, 4096, 512 );
+      Table read = BinaryFormat::read( buffer, 1, 4096, 512 );
+
+      THEN( "a legacy header is used" ) {
+
+        auto header = std::get< Table::Header >( read.header() );
+        CHECK( "92238.80c" == header.ZAID() );
+        CHECK_THAT( 236.0058, WithinRel( header.AWR() ) );
+        CHECK_THAT( 2.5301E-08, WithinRel( header.TEMP() ) );
+        CHECK( "2018-05-01" == header.date() );
+        CHECK( "U238 processed by NJOY" == header.title() );
+        CHECK( "" == header.material() );
+        verifyChunk( read );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    std::string string = chunk();
+    State< std::string::iterator > state{ 1, string.begin(), string.end() };
+    Table table( state );
+
+    WHEN( "the record layout is inconsistent" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        std::stringstream buffer;
+        CHECK_THROWS( BinaryFormat::write( table, buffer, 256, 32 ) );
+        CHECK_THROWS( BinaryFormat::write( table, buffer, 4096, 1024 ) );
+        CHECK_THROWS( BinaryFormat::write( table, buffer, 4096, 0 ) );
+        CHECK_THROWS( BinaryFormat::read( buffer, 1, 4096, 1024 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the ZAID is too long" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        std::string string = chunkWith201Header();
+        State< std::string::iterator > state{ 1, string.begin(), string.end() };
+        Table table( state );
+
+        std::stringstream buffer;
+        CHECK_THROWS( BinaryFormat::write( table, buffer, 4096, 512 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the stream is too short" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        std::stringstream buffer;
+        BinaryFormat::write( table, buffer, 4096, 512 );
+        std::stringstream truncated( buffer.str().substr( 0, 4096 + 16 ) );
+        CHECK_THROWS( BinaryFormat::read( truncated, 1, 4096, 512 ) );
+        CHECK_THROWS( BinaryFormat::read( buffer, 3, 4096, 512 ) );
+        CHECK_THROWS( BinaryFormat::read( buffer, 0, 4096, 512 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the xsdir entry is not for a binary file" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( fromBinaryFile( XsdirEntry( "92238.80c", 236.0058,
+                                                  "binary.ace", 1, 1, 6 ) ) );
+        CHECK_THROWS( fromBinaryFile( "not-a-file.ace" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunk() {
+
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWith201Header() {
+
+  return
+    "2.0.1                   92238.800nc            ENDF/B-VIII.0\n"
+    "  236.005800   2.5301E-08 2018-05-01          2\n"
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+void verifyHeader( const Table& table ) {
+
+  auto header = std::get< Table::Header >( table.header() );
+  CHECK( "92238.80c" == header.ZAID() );
+  CHECK_THAT( 236.0058, WithinRel( header.AWR() ) );
+  CHECK_THAT( 2.5301E-08, WithinRel( header.TEMP() ) );
+  CHECK( "12/13/12" == header.date() );
+  CHECK( "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)"
+         == header.title() );
+  CHECK( "mat9237" == header.material() );
+}
+
+void verifyChunk( const Table& table ) {
+
+  const auto& data = table.data();
+  for ( unsigned int i = 0; i < 16; ++i ) {
+
+    CHECK( static_cast< int >( i ) == data.IZ()[i] );
+    CHECK( 15. - i == data.AW()[i] );
+  }
+
+  CHECK( 6 == data.NXS(1) );
+  CHECK( 33074 == data.NXS(2) );
+  CHECK( 9 == data.NXS(16) );
+  CHECK( 1 == data.JXS(1) );
+  CHECK( 788721 == data.JXS(2) );
+  CHECK( 8 == data.JXS(32) );
+
+  CHECK( 6 == data.XSS().size() );
+  CHECK( 1.00000000000E+00 == data.XSS(1) );
+  CHECK( 1.03125000000E+00 == data.XSS(2) );
+  CHECK( 1.06250000000E+00 == data.XSS(3) );
+  CHECK( 1.09375000000E+00 == data.XSS(4) );
+  CHECK( 1.12500000000E+00 == data.XSS(5) );
+  CHECK( 1.15625000000E+00 == data.XSS(6) );
+}
@@ -0,0 +1,35 @@
+#ifndef NJOY_ACETK_BINARYIO
+#define NJOY_ACETK_BINARYIO
+
+// system includes
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+// other includes
+#include "tools/Log.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief Packing and unpacking of values in native binary representation
+ *
+ *  These functions are shared by the binary (type 2) ACE format, the
+ *  snapshot format and the sidecar file index. Values are stored in the
+ *  native byte order of the machine without any padding.
+ */
+class BinaryIO {
+
+public:
+
+  #include "ACEtk/BinaryIO/src/pack.hpp"
+  #include "ACEtk/BinaryIO/src/unpack.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ *  @brief Pack a value into a buffer
+ *
+ *  @param[in,out] position   the current position in the buffer
+ *  @param[in]     value      the value to be packed
+ */
+template< typename Type >
+static void pack( char*& position, Type value ) {
+
+  std::memcpy( position, &value, sizeof( Type ) );
+  position += sizeof( Type );
+}
+
+/**
+ *  @brief Pack a string into a buffer as a fixed length field
+ *
+ *  The string is padded with spaces or truncated to the length of the field.
+ *
+ *  @param[in,out] position   the current position in the buffer
+ *  @param[in]     value      the string to be packed
+ *  @param[in]     length     the length of the field
+ */
+static void pack( char*& position, const std::string& value,
+                  std::size_t length ) {
+
+  std::memset( position, ' ', length );
+  std::memcpy( position, value.data(), std::min( length, value.size() ) );
+  position += length;
+}
+
+/**
+ *  @brief Pack a value into an output stream
+ *
+ *  @param[in,out] out     the output stream
+ *  @param[in]     value   the value to be packed
+ */
+template< typename Type >
+static void pack( std::ostream& out, Type value ) {
+
+  out.write( reinterpret_cast< const char* >( &value ), sizeof( Type ) );
+}
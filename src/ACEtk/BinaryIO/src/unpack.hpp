@@ -0,0 +1,46 @@
+/**
+ *  @brief Unpack a value from a buffer
+ *
+ *  The buffer is assumed to be large enough to hold the value.
+ *
+ *  @param[in,out] position   the current position in the buffer
+ */
+template< typename Type >
+static Type unpack( const char*& position ) {
+
+  Type value;
+  std::memcpy( &value, position, sizeof( Type ) );
+  position += sizeof( Type );
+  return value;
+}
+
+/**
+ *  @brief Unpack a value from a buffer, verifying the end of the buffer
+ *
+ *  @param[in,out] position   the current position in the buffer
+ *  @param[in]     end        the end of the buffer
+ */
+template< typename Type >
+static Type unpack( const char*& position, const char* end ) {
+
+  if ( static_cast< std::size_t >( end - position ) < sizeof( Type ) ) {
+
+    Log::error( "Encountered the end of the buffer while unpacking a value" );
+    throw std::exception();
+  }
+
+  return unpack< Type >( position );
+}
+
+/**
+ *  @brief Unpack a fixed length string field from a buffer
+ *
+ *  @param[in,out] position   the current position in the buffer
+ *  @param[in]     length     the length of the field
+ */
+static std::string unpack( const char*& position, std::size_t length ) {
+
+  std::string value( position, length );
+  position += length;
+  return value;
+}
@@ -0,0 +1,79 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ACEtk/BinaryIO.hpp"
+
+// other includes
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+SCENARIO( "BinaryIO" ) {
+
+  GIVEN( "values packed into a buffer" ) {
+
+    std::vector< char > buffer( 4 + 8 + 10 );
+    char* position = buffer.data();
+    BinaryIO::pack( position, std::int32_t( -7 ) );
+    BinaryIO::pack( position, 2.5 );
+    BinaryIO::pack( position, std::string( "1001.80c" ), 10 );
+
+    WHEN( "the values are unpacked" ) {
+
+      const char* begin = buffer.data();
+      const char* end = buffer.data() + buffer.size();
+      std::int32_t integer = BinaryIO::unpack< std::int32_t >( begin );
+      double real = BinaryIO::unpack< double >( begin, end );
+      std::string string = BinaryIO::unpack( begin, 10 );
+
+      THEN( "the values are recovered" ) {
+
+        CHECK( buffer.data() + buffer.size() == position );
+        CHECK( end == begin );
+        CHECK( -7 == integer );
+        CHECK( 2.5 == real );
+        CHECK( "1001.80c  " == string );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "values packed into a stream" ) {
+
+    std::ostringstream out;
+    BinaryIO::pack( out, std::uint64_t( 42 ) );
+    BinaryIO::pack( out, -1.5 );
+    std::string buffer = out.str();
+
+    WHEN( "the values are unpacked" ) {
+
+      const char* begin = buffer.data();
+      const char* end = buffer.data() + buffer.size();
+
+      THEN( "the values are recovered" ) {
+
+        CHECK( 16 == buffer.size() );
+        CHECK( 42 == BinaryIO::unpack< std::uint64_t >( begin, end ) );
+        CHECK( -1.5 == BinaryIO::unpack< double >( begin, end ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    WHEN( "the buffer is too short" ) {
+
+      std::string buffer( 4, '\0' );
+      const char* begin = buffer.data();
+      const char* end = buffer.data() + buffer.size();
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( BinaryIO::unpack< double >( begin, end ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
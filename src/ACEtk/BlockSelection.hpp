@@ -0,0 +1,129 @@
+#ifndef NJOY_ACETK_BLOCKSELECTION
+#define NJOY_ACETK_BLOCKSELECTION
+
+// system includes
+#include <cstdint>
+#include <initializer_list>
+
+// other includes
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A selection of blocks to be loaded from an ACE table
+ *
+ *  The Block template parameter is an enumeration of the blocks of a specific
+ *  table type. The enumerated values are the zero-based index of each block
+ *  (there can be at most 32 blocks). A default constructed selection contains
+ *  all blocks.
+ */
+template < typename Block >
+class BlockSelection {
+
+  /* fields */
+  std::uint32_t mask_;
+
+  static constexpr std::uint32_t bit( Block block ) {
+
+    return std::uint32_t( 1 ) << static_cast< unsigned int >( block );
+  }
+
+  constexpr explicit BlockSelection( std::uint32_t mask ) : mask_( mask ) {}
+
+public:
+
+  /* constructor */
+
+  /**
+   *  @brief Default constructor (all blocks are selected)
+   */
+  constexpr BlockSelection() : mask_( ~std::uint32_t( 0 ) ) {}
+
+  /**
+   *  @brief Constructor for a single block
+   *
+   *  @param[in] block    the block to be selected
+   */
+  constexpr BlockSelection( Block block ) : mask_( bit( block ) ) {}
+
+  /**
+   *  @brief Constructor for a list of blocks
+   *
+   *  @param[in] blocks   the blocks to be selected
+   */
+  constexpr BlockSelection( std::initializer_list< Block > blocks ) :
+    mask_( 0 ) {
+
+    for ( auto block : blocks ) {
+
+      this->mask_ |= bit( block );
+    }
+  }
+
+  /* methods */
+
+  /**
+   *  @brief Return a selection containing all blocks
+   */
+  static constexpr BlockSelection all() { return BlockSelection(); }
+
+  /**
+   *  @brief Return an empty selection
+   */
+  static constexpr BlockSelection none() { return BlockSelection( std::uint32_t( 0 ) ); }
+
+  /**
+   *  @brief Return whether or not a block is selected
+   *
+   *  @param[in] block    the block
+   */
+  constexpr bool contains( Block block ) const {
+
+    return this->mask_ & bit( block );
+  }
+
+  /**
+   *  @brief Return whether or not all blocks are selected
+   */
+  constexpr bool isAll() const { return this->mask_ == ~std::uint32_t( 0 ); }
+
+  /**
+   *  @brief Return the union of two selections
+   *
+   *  @param[in] left     the first selection
+   *  @param[in] right    the second selection
+   */
+  friend constexpr BlockSelection operator|( const BlockSelection& left,
+                                            const BlockSelection& right ) {
+
+    return BlockSelection( left.mask_ | right.mask_ );
+  }
+
+  /**
+   *  @brief Add a selection to this selection
+   *
+   *  @param[in] right    the other selection
+   */
+  constexpr BlockSelection& operator|=( const BlockSelection& right ) {
+
+    this->mask_ |= right.mask_;
+    return *this;
+  }
+
+  constexpr bool operator==( const BlockSelection& right ) const {
+
+    return this->mask_ == right.mask_;
+  }
+
+  constexpr bool operator!=( const BlockSelection& right ) const {
+
+    return not ( *this == right );
+  }
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
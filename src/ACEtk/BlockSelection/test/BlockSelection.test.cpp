@@ -0,0 +1,80 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ACEtk/BlockSelection.hpp"
+
+// other includes
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+enum class Block : unsigned int { First = 0, Second, Third, Last = 31 };
+
+SCENARIO( "BlockSelection" ) {
+
+  GIVEN( "the default selection" ) {
+
+    BlockSelection< Block > chunk;
+
+    THEN( "all blocks are selected" ) {
+
+      CHECK( true == chunk.isAll() );
+      CHECK( true == chunk.contains( Block::First ) );
+      CHECK( true == chunk.contains( Block::Second ) );
+      CHECK( true == chunk.contains( Block::Third ) );
+      CHECK( true == chunk.contains( Block::Last ) );
+      CHECK( BlockSelection< Block >::all() == chunk );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "an empty selection" ) {
+
+    auto chunk = BlockSelection< Block >::none();
+
+    THEN( "no blocks are selected" ) {
+
+      CHECK( false == chunk.isAll() );
+      CHECK( false == chunk.contains( Block::First ) );
+      CHECK( false == chunk.contains( Block::Second ) );
+      CHECK( false == chunk.contains( Block::Third ) );
+      CHECK( false == chunk.contains( Block::Last ) );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "selections of specific blocks" ) {
+
+    BlockSelection< Block > single( Block::Second );
+    BlockSelection< Block > list = { Block::First, Block::Last };
+
+    THEN( "only the requested blocks are selected" ) {
+
+      CHECK( false == single.isAll() );
+      CHECK( false == single.contains( Block::First ) );
+      CHECK( true == single.contains( Block::Second ) );
+      CHECK( false == single.contains( Block::Third ) );
+
+      CHECK( false == list.isAll() );
+      CHECK( true == list.contains( Block::First ) );
+      CHECK( false == list.contains( Block::Second ) );
+      CHECK( true == list.contains( Block::Last ) );
+    } // THEN
+
+    THEN( "selections can be combined" ) {
+
+      auto combined = single | list;
+      CHECK( true == combined.contains( Block::First ) );
+      CHECK( true == combined.contains( Block::Second ) );
+      CHECK( false == combined.contains( Block::Third ) );
+      CHECK( true == combined.contains( Block::Last ) );
+
+      combined = Block::Third | combined;
+      CHECK( true == combined.contains( Block::Third ) );
+
+      single |= Block::Third;
+      CHECK( true == single.contains( Block::Second ) );
+      CHECK( true == single.contains( Block::Third ) );
+      CHECK( single != list );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
@@ -2,9 +2,13 @@
 #define NJOY_ACETK_CONTINUOUSENERGYTABLE
 
 // system includes
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 
 // other includes
 #include "ACEtk/Table.hpp"
+#include "ACEtk/BlockSelection.hpp"
 #include "ACEtk/continuous/PrincipalCrossSectionBlock.hpp"
 #include "ACEtk/continuous/FissionMultiplicityBlock.hpp"
 #include "ACEtk/continuous/ReactionNumberBlock.hpp"
@@ -38,39 +42,74 @@ namespace ACEtk {
  */
 class ContinuousEnergyTable : protected Table {
 
+public:
+
+  /* type aliases */
+
+  /**
+   *  @brief The blocks of the table that can be selected for loading
+   *
+   *  The blocks are listed in the order in which they are generated: a block
+   *  only depends on blocks that appear earlier in this list.
+   */
+  enum class Block : unsigned int {
+
+    ESZ = 0, NU, MTR, LQR, TYR, SIG, AND, DLW,
+    GPD, MTRP, SIGP, ANDP, DLWP, YP, UNR, DNU, BDD, DNED,
+    PTYPE, NTRO, IXS, HPD, MTRH, TYRH, SIGH, ANDH, DLWH, YH
+  };
+  using BlockSelection = ACEtk::BlockSelection< Block >;
+
+  /**
+   *  @brief Combine two blocks into a block selection
+   */
+  friend constexpr BlockSelection operator|( Block left, Block right ) {
+
+    return BlockSelection( left ) | right;
+  }
+
+private:
+
+  static constexpr unsigned int numberBlocks = 28;
+
   /* fields */
-  continuous::ESZ esz_;
-  std::optional< continuous::NU > nu_;
-  continuous::MTR mtr_;
-  continuous::LQR lqr_;
-  continuous::TYR tyr_;
-  continuous::SIG sig_;
-  continuous::AND and_;
-  continuous::DLW dlw_;
-
-  std::optional< continuous::GPD > gpd_;
-  std::optional< continuous::MTRP > mtrp_;
-  std::optional< continuous::SIGP > sigp_;
-  std::optional< continuous::ANDP > andp_;
-  std::optional< continuous::DLWP > dlwp_;
-  std::optional< continuous::YP > yp_;
-
-  std::optional< continuous::UNR > unr_;
-
-  std::optional< continuous::NU > dnu_;
-  std::optional< continuous::BDD > bdd_;
-  std::optional< continuous::DNED > dned_;
-
-  std::optional< continuous::PTYPE > ptype_;
-  std::optional< continuous::NTRO > ntro_;
-  std::optional< continuous::IXS > ixs_;
-  std::vector< continuous::HPD > hpd_;
-  std::vector< continuous::MTRH > mtrh_;
-  std::vector< continuous::TYRH > tyrh_;
-  std::vector< continuous::SIGH > sigh_;
-  std::vector< continuous::ANDH > andh_;
-  std::vector< continuous::DLWH > dlwh_;
-  std::vector< continuous::YH > yh_;
+  BlockSelection blocks_;
+  bool lazy_ = false;
+  mutable std::recursive_mutex mutex_;
+  mutable std::atomic< std::uint32_t > generated_{ 0 };
+
+  mutable continuous::ESZ esz_;
+  mutable std::optional< continuous::NU > nu_;
+  mutable continuous::MTR mtr_;
+  mutable continuous::LQR lqr_;
+  mutable continuous::TYR tyr_;
+  mutable continuous::SIG sig_;
+  mutable continuous::AND and_;
+  mutable continuous::DLW dlw_;
+
+  mutable std::optional< continuous::GPD > gpd_;
+  mutable std::optional< continuous::MTRP > mtrp_;
+  mutable std::optional< continuous::SIGP > sigp_;
+  mutable std::optional< continuous::ANDP > andp_;
+  mutable std::optional< continuous::DLWP > dlwp_;
+  mutable std::optional< continuous::YP > yp_;
+
+  mutable std::optional< continuous::UNR > unr_;
+
+  mutable std::optional< continuous::NU > dnu_;
+  mutable std::optional< continuous::BDD > bdd_;
+  mutable std::optional< continuous::DNED > dned_;
+
+  mutable std::optional< continuous::PTYPE > ptype_;
+  mutable std::optional< continuous::NTRO > ntro_;
+  mutable std::optional< continuous::IXS > ixs_;
+  mutable std::vector< continuous::HPD > hpd_;
+  mutable std::vector< continuous::MTRH > mtrh_;
+  mutable std::vector< continuous::TYRH > tyrh_;
+  mutable std::vector< continuous::SIGH > sigh_;
+  mutable std::vector< continuous::ANDH > andh_;
+  mutable std::vector< continuous::DLWH > dlwh_;
+  mutable std::vector< continuous::YH > yh_;
 
   /* auxiliary functions */
   #include "ACEtk/ContinuousEnergyTable/src/setSZA.hpp"
@@ -83,9 +122,16 @@ public:
   #include "ACEtk/ContinuousEnergyTable/src/ctor.hpp"
 
   using Table::header;
-  using Table::data;
   using Table::print;
 
+  /**
+   *  @brief Return the data arrays
+   *
+   *  The blocks of the table refer to the XSS array so only const access to
+   *  the data arrays is provided.
+   */
+  const Data& data() const { return Table::data(); }
+
   //! @todo projectile() function
   //! @todo target() function
 
@@ -257,17 +303,28 @@ public:
   /**
    *  @brief Return the principal cross section block
    */
-  const continuous::ESZ& ESZ() const { return this->esz_; }
+  const continuous::ESZ& ESZ() const {
+
+    this->load( Block::ESZ );
+    return this->esz_;
+  }
 
   /**
    *  @brief Return the principal cross section block
    */
   const continuous::ESZ& principalCrossSectionBlock() const { return this->ESZ(); }
 
+  #include "ACEtk/ContinuousEnergyTable/src/evaluate.hpp"
+  #include "ACEtk/ContinuousEnergyTable/src/evaluateReactions.hpp"
+
   /**
    *  @brief Return the fission multiplicity block
    */
-  const std::optional< continuous::NU >& NU() const { return this->nu_; }
+  const std::optional< continuous::NU >& NU() const {
+
+    this->load( Block::NU );
+    return this->nu_;
+  }
 
   /**
    *  @brief Return the fission multiplicity block
@@ -280,7 +337,11 @@ public:
   /**
    *  @brief Return the reaction number block
    */
-  const continuous::MTR& MTR() const { return this->mtr_; }
+  const continuous::MTR& MTR() const {
+
+    this->load( Block::MTR );
+    return this->mtr_;
+  }
 
   /**
    *  @brief Return the reaction number block
@@ -290,7 +351,11 @@ public:
   /**
    *  @brief Return the reaction Q value block
    */
-  const continuous::LQR& LQR() const { return this->lqr_; }
+  const continuous::LQR& LQR() const {
+
+    this->load( Block::LQR );
+    return this->lqr_;
+  }
 
   /**
    *  @brief Return the reaction Q value block
@@ -300,7 +365,11 @@ public:
   /**
    *  @brief Return the reference frame and multiplicity block
    */
-  const continuous::TYR& TYR() const { return this->tyr_; }
+  const continuous::TYR& TYR() const {
+
+    this->load( Block::TYR );
+    return this->tyr_;
+  }
 
   /**
    *  @brief Return the reference frame and multiplicity block
@@ -310,7 +379,11 @@ public:
   /**
    *  @brief Return the cross section block
    */
-  const continuous::SIG& SIG() const { return this->sig_; }
+  const continuous::SIG& SIG() const {
+
+    this->load( Block::SIG );
+    return this->sig_;
+  }
 
   /**
    *  @brief Return the cross section block
@@ -320,7 +393,11 @@ public:
   /**
    *  @brief Return the angular distribution block
    */
-  const continuous::AND& AND() const { return this->and_; }
+  const continuous::AND& AND() const {
+
+    this->load( Block::AND );
+    return this->and_;
+  }
 
   /**
    *  @brief Return the angular distribution block
@@ -330,7 +407,11 @@ public:
   /**
    *  @brief Return the energy distribution block
    */
-  const continuous::DLW& DLW() const { return this->dlw_; }
+  const continuous::DLW& DLW() const {
+
+    this->load( Block::DLW );
+    return this->dlw_;
+  }
 
   /**
    *  @brief Return the energy distribution block
@@ -340,7 +421,11 @@ public:
   /**
    *  @brief Return the photon production block
    */
-  const std::optional< continuous::GPD >& GPD() const { return this->gpd_; }
+  const std::optional< continuous::GPD >& GPD() const {
+
+    this->load( Block::GPD );
+    return this->gpd_;
+  }
 
   /**
    *  @brief Return the photon production block
@@ -353,7 +438,11 @@ public:
   /**
    *  @brief Return the photon production reaction number block
    */
-  const std::optional< continuous::MTR >& MTRP() const { return this->mtrp_; }
+  const std::optional< continuous::MTR >& MTRP() const {
+
+    this->load( Block::MTRP );
+    return this->mtrp_;
+  }
 
   /**
    *  @brief Return the photon production reaction number block
@@ -366,7 +455,11 @@ public:
   /**
    *  @brief Return the photon production cross section block
    */
-  const std::optional< continuous::SIGP >& SIGP() const { return this->sigp_; }
+  const std::optional< continuous::SIGP >& SIGP() const {
+
+    this->load( Block::SIGP );
+    return this->sigp_;
+  }
 
   /**
    *  @brief Return the photon production cross section block
@@ -379,7 +472,11 @@ public:
   /**
    *  @brief Return the photon production angular distribution block
    */
-  const std::optional< continuous::ANDP >& ANDP() const { return this->andp_; }
+  const std::optional< continuous::ANDP >& ANDP() const {
+
+    this->load( Block::ANDP );
+    return this->andp_;
+  }
 
   /**
    *  @brief Return the photon production angular distribution block
@@ -392,7 +489,11 @@ public:
   /**
    *  @brief Return the photon production energy distribution block
    */
-  const std::optional< continuous::DLWP >& DLWP() const { return this->dlwp_; }
+  const std::optional< continuous::DLWP >& DLWP() const {
+
+    this->load( Block::DLWP );
+    return this->dlwp_;
+  }
 
   /**
    *  @brief Return the photon production energy distribution block
@@ -405,7 +506,11 @@ public:
   /**
    *  @brief Return the photon multiplicity reaction number block
    */
-  const std::optional< continuous::YP >& YP() const { return this->yp_; }
+  const std::optional< continuous::YP >& YP() const {
+
+    this->load( Block::YP );
+    return this->yp_;
+  }
 
   /**
    *  @brief Return the photon multiplicity reaction number block
@@ -418,7 +523,11 @@ public:
   /**
    *  @brief Return the unresoved probability table block
    */
-  const std::optional< continuous::UNR >& UNR() const { return this->unr_; }
+  const std::optional< continuous::UNR >& UNR() const {
+
+    this->load( Block::UNR );
+    return this->unr_;
+  }
 
   /**
    *  @brief Return the unresoved probability table block
@@ -431,7 +540,11 @@ public:
   /**
    *  @brief Return the delayed fission multiplicity block
    */
-  const std::optional< continuous::NU >& DNU() const { return this->dnu_; }
+  const std::optional< continuous::NU >& DNU() const {
+
+    this->load( Block::DNU );
+    return this->dnu_;
+  }
 
   /**
    *  @brief Return the delayed fission multiplicity block
@@ -444,7 +557,11 @@ public:
   /**
    *  @brief Return the delayed neutron precursor block
    */
-  const std::optional< continuous::BDD >& BDD() const { return this->bdd_; }
+  const std::optional< continuous::BDD >& BDD() const {
+
+    this->load( Block::BDD );
+    return this->bdd_;
+  }
 
   /**
    *  @brief Return the delayed neutron precursor block
@@ -457,7 +574,11 @@ public:
   /**
    *  @brief Return the delayed neutron energy distribution block
    */
-  const std::optional< continuous::DNED >& DNED() const { return this->dned_; }
+  const std::optional< continuous::DNED >& DNED() const {
+
+    this->load( Block::DNED );
+    return this->dned_;
+  }
 
   /**
    *  @brief Return the delayed neutron energy distribution block
@@ -470,7 +591,11 @@ public:
   /**
    *  @brief Return the secondary particle type block
    */
-  const std::optional< continuous::PTYPE >& PTYPE() const { return this->ptype_; }
+  const std::optional< continuous::PTYPE >& PTYPE() const {
+
+    this->load( Block::PTYPE );
+    return this->ptype_;
+  }
 
   /**
    *  @brief Return the secondary particle type block
@@ -483,7 +608,11 @@ public:
   /**
    *  @brief Return the secondary particle information block
    */
-  const std::optional< continuous::NTRO >& NTRO() const { return this->ntro_; }
+  const std::optional< continuous::NTRO >& NTRO() const {
+
+    this->load( Block::NTRO );
+    return this->ntro_;
+  }
 
   /**
    *  @brief Return the secondary particle information block
@@ -496,7 +625,11 @@ public:
   /**
    *  @brief Return the secondary particle locator block
    */
-  const std::optional< continuous::IXS >& IXS() const { return this->ixs_; }
+  const std::optional< continuous::IXS >& IXS() const {
+
+    this->load( Block::IXS );
+    return this->ixs_;
+  }
 
   /**
    *  @brief Return the secondary particle locator block
@@ -517,6 +650,7 @@ public:
    */
   const continuous::HPD& HPD( std::size_t index ) const {
 
+    this->load( Block::HPD );
     return this->hpd_[ index - 1 ];
   }
 
@@ -544,6 +678,7 @@ public:
    */
   const continuous::MTRH& MTRH( std::size_t index ) const {
 
+    this->load( Block::MTRH );
     return this->mtrh_[ index - 1 ];
   }
 
@@ -571,6 +706,7 @@ public:
    */
   const continuous::TYRH& TYRH( std::size_t index ) const {
 
+    this->load( Block::TYRH );
     return this->tyrh_[ index - 1 ];
   }
 
@@ -599,6 +735,7 @@ public:
    */
   const continuous::SIGH& SIGH( std::size_t index ) const {
 
+    this->load( Block::SIGH );
     return this->sigh_[ index - 1 ];
   }
 
@@ -627,6 +764,7 @@ public:
    */
   const continuous::ANDH& ANDH( std::size_t index ) const {
 
+    this->load( Block::ANDH );
     return this->andh_[ index - 1 ];
   }
 
@@ -655,6 +793,7 @@ public:
    */
   const continuous::DLWH& DLWH( std::size_t index ) const {
 
+    this->load( Block::DLWH );
     return this->dlwh_[ index - 1 ];
   }
 
@@ -683,6 +822,7 @@ public:
    */
   const continuous::YH& YH( std::size_t index ) const {
 
+    this->load( Block::YH );
     return this->yh_[ index - 1 ];
   }
 
@@ -1,9 +1,40 @@
 /**
  *  @brief Copy constructor using a generic table
  *
+ *  When lazy generation is requested, the blocks of the table are only
+ *  generated when they are first requested. Lazy generation is thread safe.
+ *
+ *  @param[in] table    the generic table to be copied
+ *  @param[in] lazy     the flag to indicate lazy block generation
+ */
+ContinuousEnergyTable( const Table& table, bool lazy = false ) :
+  ContinuousEnergyTable( table, BlockSelection::all(), lazy ) {}
+
+/**
+ *  @brief Move constructor using a generic table
+ *
+ *  When lazy generation is requested, the blocks of the table are only
+ *  generated when they are first requested. Lazy generation is thread safe.
+ *
+ *  @param[in] table    the generic table to be moved
+ *  @param[in] lazy     the flag to indicate lazy block generation
+ */
+ContinuousEnergyTable( Table&& table, bool lazy = false ) :
+  ContinuousEnergyTable( std::move( table ), BlockSelection::all(), lazy ) {}
+
+/**
+ *  @brief Copy constructor using a generic table and a block selection
+ *
+ *  Only the selected blocks (and the blocks they depend on) are generated.
+ *  Requesting a block that was not selected results in an exception.
+ *
  *  @param[in] table    the generic table to be copied
+ *  @param[in] blocks   the blocks to be loaded
+ *  @param[in] lazy     the flag to indicate lazy block generation
  */
-ContinuousEnergyTable( const Table& table ): Table( table ) {
+ContinuousEnergyTable( const Table& table, BlockSelection blocks,
+                       bool lazy = false ) :
+  Table( table ), blocks_( blocks ), lazy_( lazy ) {
 
   this->verifyType();
   this->setSZA();
@@ -11,11 +42,18 @@ ContinuousEnergyTable( const Table& table ): Table( table ) {
 }
 
 /**
- *  @brief Move constructor using a generic table
+ *  @brief Move constructor using a generic table and a block selection
+ *
+ *  Only the selected blocks (and the blocks they depend on) are generated.
+ *  Requesting a block that was not selected results in an exception.
  *
  *  @param[in] table    the generic table to be moved
+ *  @param[in] blocks   the blocks to be loaded
+ *  @param[in] lazy     the flag to indicate lazy block generation
  */
-ContinuousEnergyTable( Table&& table ): Table( std::move( table ) ) {
+ContinuousEnergyTable( Table&& table, BlockSelection blocks,
+                       bool lazy = false ) :
+  Table( std::move( table ) ), blocks_( blocks ), lazy_( lazy ) {
 
   this->verifyType();
   this->setSZA();
@@ -25,32 +63,37 @@ ContinuousEnergyTable( Table&& table ): Table( std::move( table ) ) {
 /**
  *  @brief Copy constructor using a continuous energy table
  *
+ *  The table was already verified so the copy only shares the data of the
+ *  table. Its blocks are generated when they are first requested, so that
+ *  copying a table has a negligible cost.
+ *
  *  @param[in] table    the continuous energy table to be copied
  */
 ContinuousEnergyTable( const ContinuousEnergyTable& table ) :
-  Table( table ) {
+  Table( table ), blocks_( table.blocks_ ), lazy_( table.lazy_ ) {
 
-  this->verifyType();
-  this->setSZA();
-  this->generateBlocks();
+  this->resetBlocks();
 }
 
 /**
  *  @brief Move constructor using a continuous energy table
  *
+ *  The blocks of the table are generated when they are first requested.
+ *
  *  @param[in] table    the continuous energy table to be moved
  */
 ContinuousEnergyTable( ContinuousEnergyTable&& table ) :
-  Table( std::move( table ) ) {
+  Table( std::move( table ) ), blocks_( table.blocks_ ),
+  lazy_( table.lazy_ ) {
 
-  this->verifyType();
-  this->setSZA();
-  this->generateBlocks();
+  this->resetBlocks();
 }
 
 /**
  *  @brief Copy assignment using a continuous energy table
  *
+ *  The blocks of the table are generated when they are first requested.
+ *
  *  @param[in] table    the continuous energy table to be copied
  */
 ContinuousEnergyTable& operator=( const ContinuousEnergyTable& base ) {
@@ -58,9 +101,9 @@ ContinuousEnergyTable& operator=( const ContinuousEnergyTable& base ) {
   if ( this != &base ) {
 
     Table::operator=( base );
-    this->verifyType();
-    this->setSZA();
-    this->generateBlocks();
+    this->blocks_ = base.blocks_;
+    this->lazy_ = base.lazy_;
+    this->resetBlocks();
   }
   return *this;
 }
@@ -68,6 +111,8 @@ ContinuousEnergyTable& operator=( const ContinuousEnergyTable& base ) {
 /**
  *  @brief Move assignment using a continuous energy table
  *
+ *  The blocks of the table are generated when they are first requested.
+ *
  *  @param[in] table    the continuous energy table to be moved
  */
 ContinuousEnergyTable& operator=( ContinuousEnergyTable&& base ) {
@@ -75,9 +120,9 @@ ContinuousEnergyTable& operator=( ContinuousEnergyTable&& base ) {
   if ( this != &base ) {
 
     Table::operator=( std::move( base ) );
-    this->verifyType();
-    this->setSZA();
-    this->generateBlocks();
+    this->blocks_ = base.blocks_;
+    this->lazy_ = base.lazy_;
+    this->resetBlocks();
   }
   return *this;
 }
@@ -0,0 +1,46 @@
+/**
+ *  @brief Evaluate the principal cross sections for a batch of energies
+ *
+ *  The total, elastic and disappearance cross sections and the average
+ *  heating numbers are interpolated on the energy grid of the ESZ block
+ *  (see continuous::ESZ::evaluate). An output array that is a null pointer
+ *  is not evaluated.
+ *
+ *  @param[in]  index           the energy grid index of the ESZ block
+ *  @param[in]  energies        the energy values
+ *  @param[in]  size            the number of energy values
+ *  @param[out] total           the total cross section values
+ *  @param[out] elastic         the elastic cross section values
+ *  @param[out] disappearance   the disappearance cross section values
+ *  @param[out] heating         the average heating numbers
+ */
+void evaluate( const continuous::ESZ::EnergyGridIndex& index,
+               const double* energies, std::size_t size,
+               double* total, double* elastic,
+               double* disappearance, double* heating ) const {
+
+  this->ESZ().evaluate( index, energies, size,
+                        total, elastic, disappearance, heating );
+}
+
+/**
+ *  @brief Evaluate the principal cross sections for a batch of energies
+ *
+ *  An energy grid index is made for every call. When evaluating many
+ *  batches, the index should be made once (using ESZ().energyGridIndex())
+ *  and passed to the evaluate function instead.
+ *
+ *  @param[in]  energies        the energy values
+ *  @param[in]  size            the number of energy values
+ *  @param[out] total           the total cross section values
+ *  @param[out] elastic         the elastic cross section values
+ *  @param[out] disappearance   the disappearance cross section values
+ *  @param[out] heating         the average heating numbers
+ */
+void evaluate( const double* energies, std::size_t size,
+               double* total, double* elastic,
+               double* disappearance, double* heating ) const {
+
+  this->evaluate( this->ESZ().energyGridIndex(), energies, size,
+                  total, elastic, disappearance, heating );
+}
@@ -0,0 +1,86 @@
+/**
+ *  @brief Evaluate the cross sections of all reactions at an energy
+ *
+ *  The energy is located once on the energy grid of the ESZ block (using a
+ *  binary search) after which the cross section of each reaction in the SIG
+ *  block is interpolated using its energy index. The values are given in the
+ *  order of the reaction numbers in the MTR block.
+ *
+ *  @param[in]  energy   the energy value
+ *  @param[out] values   the cross section values (NTR values)
+ */
+void evaluateReactions( double energy, double* values ) const {
+
+  const auto location = this->ESZ().locate( energy );
+  this->SIG().evaluate( location.index, location.fraction, values );
+}
+
+/**
+ *  @brief Evaluate the cross sections of all reactions at an energy
+ *
+ *  The energy is located once on the energy grid using the energy grid
+ *  index after which the cross section of each reaction in the SIG block is
+ *  interpolated using its energy index. The values are given in the order of
+ *  the reaction numbers in the MTR block.
+ *
+ *  @param[in]  index    the energy grid index of the ESZ block
+ *  @param[in]  energy   the energy value
+ *  @param[out] values   the cross section values (NTR values)
+ */
+void evaluateReactions( const continuous::ESZ::EnergyGridIndex& index,
+                        double energy, double* values ) const {
+
+  std::size_t interval;
+  double fraction;
+  this->ESZ().locate( index, &energy, 1, &interval, &fraction );
+  this->SIG().evaluate( interval, fraction, values );
+}
+
+/**
+ *  @brief Evaluate the cross sections of all reactions for a batch of
+ *         energies
+ *
+ *  The values are stored as one contiguous array per reaction (in the order
+ *  of the reaction numbers in the MTR block): the value of reaction i
+ *  (one-based) for energy j (zero-based) is stored in
+ *  values[ ( i - 1 ) * size + j ]. The buffer must therefore hold
+ *  NTR * size values.
+ *
+ *  @param[in]  index      the energy grid index of the ESZ block
+ *  @param[in]  energies   the energy values
+ *  @param[in]  size       the number of energy values
+ *  @param[out] values     the cross section values (NTR * size values)
+ */
+void evaluateReactions( const continuous::ESZ::EnergyGridIndex& index,
+                        const double* energies, std::size_t size,
+                        double* values ) const {
+
+  constexpr std::size_t chunk = 256;
+  std::size_t intervals[ chunk ];
+  double fractions[ chunk ];
+  for ( std::size_t start = 0; start < size; start += chunk ) {
+
+    const std::size_t length = std::min( chunk, size - start );
+    this->ESZ().locate( index, energies + start, length, intervals, fractions );
+    this->SIG().evaluate( intervals, fractions, length, values + start, size );
+  }
+}
+
+/**
+ *  @brief Evaluate the cross sections of all reactions for a batch of
+ *         energies
+ *
+ *  An energy grid index is made for every call. When evaluating many
+ *  batches, the index should be made once (using ESZ().energyGridIndex())
+ *  and passed to the evaluateReactions function instead.
+ *
+ *  @param[in]  energies   the energy values
+ *  @param[in]  size       the number of energy values
+ *  @param[out] values     the cross section values (NTR * size values)
+ */
+void evaluateReactions( const double* energies, std::size_t size,
+                        double* values ) const {
+
+  this->evaluateReactions( this->ESZ().energyGridIndex(), energies, size,
+                           values );
+}
@@ -87,14 +87,14 @@ auto block( std::size_t particle, std::size_t index ) const {
   // assumption: blocks are stored in sequence!
 
   auto begin = this->data().XSS().begin();
-  std::size_t start = this->IXS()->LLOC( particle, index );
+  std::size_t start = this->ixs_->LLOC( particle, index );
 
   // look for the first value that is larger then or equal to the start locator
   std::size_t end = 0;
-  auto iter = std::find_if( this->IXS()->begin() + ( particle - 1 ) * 10 + index,
-                            this->IXS()->end(),
+  auto iter = std::find_if( this->ixs_->begin() + ( particle - 1 ) * 10 + index,
+                            this->ixs_->end(),
                             [start] ( auto&& value ) { return value >= start; } );
-  if ( iter != this->IXS()->end() ) {
+  if ( iter != this->ixs_->end() ) {
 
     end = *iter;
   }
@@ -104,198 +104,404 @@ auto block( std::size_t particle, std::size_t index ) const {
              end != 0 ? begin + end - 1 : this->data().XSS().end() );
 }
 
-void generateBlocks() {
+void generateBlock( Block blockIndex ) const {
 
-  // reset optional blocks
-  this->nu_ = std::nullopt;
-  this->gpd_ = std::nullopt;
-  this->mtrp_ = std::nullopt;
-  this->sigp_ = std::nullopt;
-  this->andp_ = std::nullopt;
-  this->dlwp_ = std::nullopt;
-  this->yp_ = std::nullopt;
-  this->unr_ = std::nullopt;
-  this->dnu_ = std::nullopt;
-  this->bdd_ = std::nullopt;
-  this->dned_ = std::nullopt;
-  this->ptype_ = std::nullopt;
-  this->ntro_ = std::nullopt;
-  this->ixs_ = std::nullopt;
+  using Iterator = std::vector< double >::const_iterator;
+  std::pair< Iterator, Iterator > iterators;
+  std::pair< Iterator, Iterator > locators;
 
-  // clear vectors
-  this->hpd_.clear();
-  this->mtrh_.clear();
-  this->tyrh_.clear();
-  this->sigh_.clear();
-  this->andh_.clear();
-  this->dlwh_.clear();
-  this->yh_.clear();
+  // blocks used by other blocks are generated first
+  if ( blockIndex == Block::DLW ) {
 
-  // starting iterator into the XSS array
-  auto begin = this->data().XSS().begin();
-
-  // principal cross section block
-  auto iterators = block( 1 );
-  this->esz_ = continuous::ESZ( iterators.first, iterators.second, this->NES() );
+    this->generate( Block::TYR );
+  }
+  if ( blockIndex >= Block::HPD ) {
 
-  // nubar for fissile isotopes
-  bool present = ( this->data().JXS(2) > 0 );
-  if ( present ) {
+    this->generate( Block::NTRO );
+    this->generate( Block::IXS );
+  }
+  if ( blockIndex == Block::DLWH ) {
 
-    iterators = block( 2 );
-    this->nu_ = continuous::NU( iterators.first, iterators.second );
+    this->generate( Block::TYRH );
   }
 
-  // reaction number block
-  iterators = block( 3 );
-  this->mtr_ = continuous::MTR( iterators.first, iterators.second, this->NTR() );
+  switch ( blockIndex ) {
 
-  // Q value block
-  iterators = block( 4 );
-  this->lqr_ = continuous::LQR( iterators.first, iterators.second, this->NTR() );
+    // principal cross section block
+    case Block::ESZ : {
 
-  // reference frame and multiplicity block
-  iterators = block( 5 );
-  this->tyr_ = continuous::TYR( iterators.first, iterators.second, this->NTR() );
+      iterators = block( 1 );
+      this->esz_ = continuous::ESZ( iterators.first, iterators.second, this->NES() );
+      break;
+    }
+    // nubar for fissile isotopes
+    case Block::NU : {
 
-  // cross section block
-  auto locators = block( 6 );
-  iterators = block( 7 );
-  this->sig_ = continuous::SIG( locators.first, iterators.first, iterators.second,
-                                this->NTR() );
+      if ( this->data().JXS(2) > 0 ) {
 
-  // angular distribution block
-  locators = block( 8 );
-  iterators = block( 9 );
-  this->and_ = continuous::AND( locators.first, iterators.first, iterators.second,
-                                this->NR() );
+        iterators = block( 2 );
+        this->nu_ = continuous::NU( iterators.first, iterators.second );
+      }
+      break;
+    }
+    // reaction number block
+    case Block::MTR : {
 
-  // energy distribution block
-  locators = block( 10 );
-  iterators = block( 11 );
-  this->dlw_ = continuous::DLW( locators.first, iterators.first, iterators.second,
-                                this->TYR(), this->NR() );
+      iterators = block( 3 );
+      this->mtr_ = continuous::MTR( iterators.first, iterators.second, this->NTR() );
+      break;
+    }
+    // Q value block
+    case Block::LQR : {
 
-  // secondary photon data
-  present = ( this->NTRP() > 0 );
-  if ( present ) {
+      iterators = block( 4 );
+      this->lqr_ = continuous::LQR( iterators.first, iterators.second, this->NTR() );
+      break;
+    }
+    // reference frame and multiplicity block
+    case Block::TYR : {
 
+      iterators = block( 5 );
+      this->tyr_ = continuous::TYR( iterators.first, iterators.second, this->NTR() );
+      break;
+    }
+    // cross section block
+    case Block::SIG : {
+
+      locators = block( 6 );
+      iterators = block( 7 );
+      this->sig_ = continuous::SIG( locators.first, iterators.first, iterators.second,
+                                    this->NTR() );
+      break;
+    }
+    // angular distribution block
+    case Block::AND : {
+
+      locators = block( 8 );
+      iterators = block( 9 );
+      this->and_ = continuous::AND( locators.first, iterators.first, iterators.second,
+                                    this->NR() );
+      break;
+    }
+    // energy distribution block
+    case Block::DLW : {
+
+      locators = block( 10 );
+      iterators = block( 11 );
+      this->dlw_ = continuous::DLW( locators.first, iterators.first, iterators.second,
+                                    this->tyr_, this->NR() );
+      break;
+    }
     // secondary photon data: total photon production cross section
-    iterators = block( 12 );
-    this->gpd_ = continuous::GPD( iterators.first, iterators.second, this->NES() );
+    case Block::GPD : {
 
+      if ( this->NTRP() > 0 ) {
+
+        iterators = block( 12 );
+        this->gpd_ = continuous::GPD( iterators.first, iterators.second, this->NES() );
+      }
+      break;
+    }
     // secondary photon data: photon production reaction numbers
-    iterators = block( 13 );
-    this->mtrp_ = continuous::MTRP( iterators.first, iterators.second, this->NTRP() );
+    case Block::MTRP : {
+
+      if ( this->NTRP() > 0 ) {
 
+        iterators = block( 13 );
+        this->mtrp_ = continuous::MTRP( iterators.first, iterators.second, this->NTRP() );
+      }
+      break;
+    }
     // secondary photon data: photon production cross sections
-    locators = block( 14 );
-    iterators = block( 15 );
-    this->sigp_ = continuous::SIGP( locators.first, iterators.first, iterators.second,
-                                    this->NTRP() );
+    case Block::SIGP : {
+
+      if ( this->NTRP() > 0 ) {
 
+        locators = block( 14 );
+        iterators = block( 15 );
+        this->sigp_ = continuous::SIGP( locators.first, iterators.first, iterators.second,
+                                        this->NTRP() );
+      }
+      break;
+    }
     // secondary photon data: photon angular distributions
-    locators = block( 16 );
-    iterators = block( 17 );
-    this->andp_ = continuous::ANDP( locators.first, iterators.first, iterators.second,
-                                    this->NTRP() );
+    case Block::ANDP : {
 
+      if ( this->NTRP() > 0 ) {
+
+        locators = block( 16 );
+        iterators = block( 17 );
+        this->andp_ = continuous::ANDP( locators.first, iterators.first, iterators.second,
+                                        this->NTRP() );
+      }
+      break;
+    }
     // secondary photon data: photon energy distributions
-    locators = block( 18 );
-    iterators = block( 19 );
-    this->dlwp_ = continuous::DLWP( locators.first, iterators.first, iterators.second,
-                                    this->NTRP() );
+    case Block::DLWP : {
 
+      if ( this->NTRP() > 0 ) {
+
+        locators = block( 18 );
+        iterators = block( 19 );
+        this->dlwp_ = continuous::DLWP( locators.first, iterators.first, iterators.second,
+                                        this->NTRP() );
+      }
+      break;
+    }
     // secondary photon data: photon yield data
-    iterators = block( 20 );
-    this->yp_ = continuous::YP( iterators.first, iterators.second );
-  }
+    case Block::YP : {
 
-  // unresolved resonance tables
-  present = ( this->data().JXS(23) > 0 );
-  if ( present ) {
+      if ( this->NTRP() > 0 ) {
 
-    iterators = block( 23 );
-    this->unr_ = continuous::UNR( iterators.first, iterators.second );
-  }
+        iterators = block( 20 );
+        this->yp_ = continuous::YP( iterators.first, iterators.second );
+      }
+      break;
+    }
+    // unresolved resonance tables
+    case Block::UNR : {
 
-  // delayed neutron data: delayed nubar for fissile isotopes
-  present = ( this->data().JXS(24) > 0 );
-  if ( present ) {
+      if ( this->data().JXS(23) > 0 ) {
 
-    iterators = block( 24 );
-    this->dnu_ = continuous::NU( iterators.first, iterators.second );
-  }
+        iterators = block( 23 );
+        this->unr_ = continuous::UNR( iterators.first, iterators.second );
+      }
+      break;
+    }
+    // delayed neutron data: delayed nubar for fissile isotopes
+    case Block::DNU : {
 
-  // delayed neutron data
-  present = ( this->NPCR() > 0 );
-  if ( present ) {
+      if ( this->data().JXS(24) > 0 ) {
 
+        iterators = block( 24 );
+        this->dnu_ = continuous::NU( iterators.first, iterators.second );
+      }
+      break;
+    }
     // delayed neutron data: precursor data
-    iterators = block( 25 );
-    this->bdd_ = continuous::BDD( iterators.first, iterators.second, this->NPCR() );
+    case Block::BDD : {
 
+      if ( this->NPCR() > 0 ) {
+
+        iterators = block( 25 );
+        this->bdd_ = continuous::BDD( iterators.first, iterators.second, this->NPCR() );
+      }
+      break;
+    }
     // delayed neutron data: spectra
-    locators = block( 26 );
-    iterators = block( 27 );
-    this->dned_ = continuous::DNED( locators.first, iterators.first, iterators.second,
-                                    this->NPCR() );
-  }
+    case Block::DNED : {
 
-  // secondary particle data
-  present = ( this->NTYPE() > 0 );
-  if ( present ) {
+      if ( this->NPCR() > 0 ) {
 
+        locators = block( 26 );
+        iterators = block( 27 );
+        this->dned_ = continuous::DNED( locators.first, iterators.first, iterators.second,
+                                        this->NPCR() );
+      }
+      break;
+    }
     // secondary particle data: available particle types
-    iterators = block( 30 );
-    this->ptype_ = continuous::PTYPE( iterators.first, iterators.second, this->NTYPE() );
+    case Block::PTYPE : {
 
-    // secondary particle data: number of reactions per type
-    iterators = block( 31 );
-    this->ntro_ = continuous::NTRO( iterators.first, iterators.second, this->NTYPE() );
+      if ( this->NTYPE() > 0 ) {
 
+        iterators = block( 30 );
+        this->ptype_ = continuous::PTYPE( iterators.first, iterators.second, this->NTYPE() );
+      }
+      break;
+    }
     // secondary particle data: number of reactions per type
-    iterators = block( 32 );
-    this->ixs_ = continuous::IXS( iterators.first, iterators.second, this->NTYPE() );
-
-    // secondary particle data: data blocks
-    for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
-
-      // secondary particle data: total production cross section
-      iterators = block( index, 1 );
-      this->hpd_.emplace_back( iterators.first, iterators.second );
-
-      // secondary particle data: reaction numbers
-      iterators = block( index, 2 );
-      this->mtrh_.emplace_back( iterators.first, iterators.second,
-                                this->NTRO()->NP( index ) );
-
-      // secondary particle data: reference frame and multiplicity
-      iterators = block( index, 3 );
-      this->tyrh_.emplace_back( iterators.first, iterators.second,
-                                this->NTRO()->NP( index ) );
-
-      // secondary particle data: production cross section data
-      locators = block( index, 4 );
-      iterators = block( index, 5 );
-      this->sigh_.emplace_back( locators.first, iterators.first, iterators.second,
-                                this->NTRO()->NP( index ) );
-
-      // secondary particle data: angular distributions
-      locators = block( index, 6 );
-      iterators = block( index, 7 );
-      this->andh_.emplace_back( locators.first, iterators.first, iterators.second,
-                                this->NTRO()->NP( index ) );
-
-      // secondary particle data: energy distributions
-      locators = block( index, 8 );
-      iterators = block( index, 9 );
-      this->dlwh_.emplace_back( locators.first, iterators.first, iterators.second,
-                                this->TYRH( index ), this->NTRO()->NP( index ) );
-
-      // secondary particle data: multiplicity reaction numbers
-      iterators = block( index, 10 );
-      this->yh_.emplace_back( iterators.first, iterators.second );
+    case Block::NTRO : {
+
+      if ( this->NTYPE() > 0 ) {
+
+        iterators = block( 31 );
+        this->ntro_ = continuous::NTRO( iterators.first, iterators.second, this->NTYPE() );
+      }
+      break;
+    }
+    // secondary particle data: locators
+    case Block::IXS : {
+
+      if ( this->NTYPE() > 0 ) {
+
+        iterators = block( 32 );
+        this->ixs_ = continuous::IXS( iterators.first, iterators.second, this->NTYPE() );
+      }
+      break;
+    }
+    // secondary particle data: total production cross section
+    case Block::HPD : {
+
+      this->hpd_.clear();
+      for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
+
+        iterators = block( index, 1 );
+        this->hpd_.emplace_back( iterators.first, iterators.second );
+      }
+      break;
+    }
+    // secondary particle data: reaction numbers
+    case Block::MTRH : {
+
+      this->mtrh_.clear();
+      for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
+
+        iterators = block( index, 2 );
+        this->mtrh_.emplace_back( iterators.first, iterators.second,
+                                  this->ntro_->NP( index ) );
+      }
+      break;
+    }
+    // secondary particle data: reference frame and multiplicity
+    case Block::TYRH : {
+
+      this->tyrh_.clear();
+      for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
+
+        iterators = block( index, 3 );
+        this->tyrh_.emplace_back( iterators.first, iterators.second,
+                                  this->ntro_->NP( index ) );
+      }
+      break;
+    }
+    // secondary particle data: production cross section data
+    case Block::SIGH : {
+
+      this->sigh_.clear();
+      for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
+
+        locators = block( index, 4 );
+        iterators = block( index, 5 );
+        this->sigh_.emplace_back( locators.first, iterators.first, iterators.second,
+                                  this->ntro_->NP( index ) );
+      }
+      break;
+    }
+    // secondary particle data: angular distributions
+    case Block::ANDH : {
+
+      this->andh_.clear();
+      for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
+
+        locators = block( index, 6 );
+        iterators = block( index, 7 );
+        this->andh_.emplace_back( locators.first, iterators.first, iterators.second,
+                                  this->ntro_->NP( index ) );
+      }
+      break;
+    }
+    // secondary particle data: energy distributions
+    case Block::DLWH : {
+
+      this->dlwh_.clear();
+      for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
+
+        locators = block( index, 8 );
+        iterators = block( index, 9 );
+        this->dlwh_.emplace_back( locators.first, iterators.first, iterators.second,
+                                  this->tyrh_[ index - 1 ], this->ntro_->NP( index ) );
+      }
+      break;
+    }
+    // secondary particle data: multiplicity reaction numbers
+    case Block::YH : {
+
+      this->yh_.clear();
+      for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
+
+        iterators = block( index, 10 );
+        this->yh_.emplace_back( iterators.first, iterators.second );
+      }
+      break;
+    }
+  }
+}
+
+void generate( Block blockIndex ) const {
+
+  // blocks are generated only once, the lock is only taken when the block
+  // has not been generated yet (it is recursive since blocks may depend on
+  // other blocks)
+  const std::uint32_t bit = 1u << static_cast< unsigned int >( blockIndex );
+  if ( not ( this->generated_.load( std::memory_order_acquire ) & bit ) ) {
+
+    std::lock_guard< std::recursive_mutex > lock( this->mutex_ );
+    if ( not ( this->generated_.load( std::memory_order_relaxed ) & bit ) ) {
+
+      this->generateBlock( blockIndex );
+      this->generated_.fetch_or( bit, std::memory_order_release );
+    }
+  }
+}
+
+void load( Block block ) const {
+
+  // blocks that were generated (either because they were selected or because
+  // a selected block depends on them) can always be accessed
+  const std::uint32_t bit = 1u << static_cast< unsigned int >( block );
+  if ( not ( this->generated_.load( std::memory_order_acquire ) & bit ) ) {
+
+    if ( not this->blocks_.contains( block ) ) {
+
+      Log::error( "The requested block was not selected for loading" );
+      Log::info( "Block index: {}", static_cast< unsigned int >( block ) );
+      throw std::exception();
+    }
+    this->generate( block );
+  }
+}
+
+void resetBlocks() {
+
+  this->generated_ = 0;
+
+  this->esz_ = continuous::ESZ();
+  this->mtr_ = continuous::MTR();
+  this->lqr_ = continuous::LQR();
+  this->tyr_ = continuous::TYR();
+  this->sig_ = continuous::SIG();
+  this->and_ = continuous::AND();
+  this->dlw_ = continuous::DLW();
+
+  this->nu_ = std::nullopt;
+  this->gpd_ = std::nullopt;
+  this->mtrp_ = std::nullopt;
+  this->sigp_ = std::nullopt;
+  this->andp_ = std::nullopt;
+  this->dlwp_ = std::nullopt;
+  this->yp_ = std::nullopt;
+  this->unr_ = std::nullopt;
+  this->dnu_ = std::nullopt;
+  this->bdd_ = std::nullopt;
+  this->dned_ = std::nullopt;
+  this->ptype_ = std::nullopt;
+  this->ntro_ = std::nullopt;
+  this->ixs_ = std::nullopt;
+
+  this->hpd_.clear();
+  this->mtrh_.clear();
+  this->tyrh_.clear();
+  this->sigh_.clear();
+  this->andh_.clear();
+  this->dlwh_.clear();
+  this->yh_.clear();
+}
+
+void generateBlocks() {
+
+  this->resetBlocks();
+
+  // in lazy mode, blocks are generated when they are requested
+  if ( not this->lazy_ ) {
+
+    for ( unsigned int index = 0; index < numberBlocks; ++index ) {
+
+      const auto block = static_cast< Block >( index );
+      if ( this->blocks_.contains( block ) ) {
+
+        this->generate( block );
+      }
     }
   }
 }
@@ -46,8 +46,8 @@ void setSZA() {
       }
     }
 
-    this->data().NXS(9) = s;
-    this->data().NXS(10) = z;
-    this->data().NXS(11) = a;
+    Table::data().NXS(9) = s;
+    Table::data().NXS(10) = z;
+    Table::data().NXS(11) = a;
   }
 }
\ No newline at end of file
@@ -7,6 +7,8 @@ using Catch::Matchers::WithinRel;
 #include "ACEtk/ContinuousEnergyTable.hpp"
 
 // other includes
+#include <memory>
+#include <thread>
 #include "ACEtk/fromFile.hpp"
 
 // convenience typedefs
@@ -179,6 +181,96 @@ SCENARIO( "ContinuousEnergyTable" ) {
       } // THEN
     } // WHEN
 
+    WHEN( "a ContinuousEnergyTable is copied and the original is destroyed" ) {
+
+      auto chunk = std::make_unique< ContinuousEnergyTable >( fromFile( "2003.710nc" ) );
+      ContinuousEnergyTable copy( *chunk );
+      ContinuousEnergyTable assigned( fromFile( "2003.710nc" ) );
+      assigned = *chunk;
+
+      // the copies share the XSS array instead of copying it
+      CHECK( chunk->data().XSS().data() == copy.data().XSS().data() );
+      CHECK( chunk->data().XSS().data() == assigned.data().XSS().data() );
+      chunk.reset();
+
+      THEN( "the blocks of the copies are generated from the shared data" ) {
+
+        verifyChunkHe3( copy );
+        verifyChunkHe3( assigned );
+      } // THEN
+    } // WHEN
+
+    WHEN( "constructing a ContinuousEnergyTable with lazy block generation" ) {
+
+      ContinuousEnergyTable chunk( fromFile( "2003.710nc" ), true );
+      ContinuousEnergyTable copy( chunk );
+
+      THEN( "a ContinuousEnergyTable can be constructed and members can be "
+            "tested" ) {
+
+        verifyChunkHe3( chunk );
+        verifyChunkHe3( copy );
+      } // THEN
+    } // WHEN
+
+    WHEN( "blocks are generated lazily from multiple threads" ) {
+
+      ContinuousEnergyTable chunk( fromFile( "2003.710nc" ), true );
+
+      std::vector< std::size_t > sizes( 4 );
+      std::vector< std::thread > threads;
+      for ( std::size_t index = 0; index < sizes.size(); ++index ) {
+
+        threads.emplace_back( [&chunk, &sizes, index] {
+
+          sizes[index] = chunk.DLWH( 1 ).length() + chunk.SIG().length() +
+                         chunk.ESZ().length();
+        } );
+      }
+      for ( auto& thread : threads ) { thread.join(); }
+
+      THEN( "every thread sees the same blocks" ) {
+
+        CHECK( sizes[0] == chunk.DLWH( 1 ).length() + chunk.SIG().length() +
+                           chunk.ESZ().length() );
+        CHECK( sizes[0] == sizes[1] );
+        CHECK( sizes[0] == sizes[2] );
+        CHECK( sizes[0] == sizes[3] );
+        verifyChunkHe3( chunk );
+      } // THEN
+    } // WHEN
+
+    WHEN( "constructing a ContinuousEnergyTable with a block selection" ) {
+
+      using Block = ContinuousEnergyTable::Block;
+      ContinuousEnergyTable full( fromFile( "2003.710nc" ) );
+      ContinuousEnergyTable chunk( fromFile( "2003.710nc" ),
+                                   Block::ESZ | Block::SIG | Block::MTR );
+      ContinuousEnergyTable lazy( fromFile( "2003.710nc" ),
+                                  { Block::DLW, Block::DLWH }, true );
+      ContinuousEnergyTable copy( chunk );
+
+      THEN( "only the selected blocks are available" ) {
+
+        CHECK( full.ESZ().length() == chunk.ESZ().length() );
+        CHECK( full.SIG().length() == chunk.SIG().length() );
+        CHECK( full.MTR().MTs().size() == chunk.MTR().MTs().size() );
+        CHECK( full.MTR().MTs().back() == chunk.MTR().MTs().back() );
+        CHECK( full.ESZ().length() == copy.ESZ().length() );
+        CHECK_THROWS( chunk.LQR() );
+        CHECK_THROWS( chunk.DLW() );
+        CHECK_THROWS( chunk.HPD( 1 ) );
+        CHECK_THROWS( copy.AND() );
+
+        CHECK( full.DLW().length() == lazy.DLW().length() );
+        CHECK( full.DLWH( 1 ).length() == lazy.DLWH( 1 ).length() );
+        CHECK( full.TYR().length() == lazy.TYR().length() );
+        CHECK( full.TYRH( 1 ).length() == lazy.TYRH( 1 ).length() );
+        CHECK_THROWS( lazy.ESZ() );
+        CHECK_THROWS( lazy.SIG() );
+      } // THEN
+    } // WHEN
+
     WHEN( "constructing a ContinuousEnergyTable from its components" ) {
 
       ContinuousEnergyTable base( fromFile( "2003.710nc" ) );
@@ -218,6 +310,72 @@ SCENARIO( "ContinuousEnergyTable" ) {
         verifyChunkHe3( chunk );
       }
     } // WHEN
+
+    WHEN( "the principal cross sections are evaluated for a batch of "
+          "energies" ) {
+
+      ContinuousEnergyTable chunk( fromFile( "2003.710nc" ) );
+      const auto& esz = chunk.ESZ();
+      std::vector< double > energies = { 1e-12, esz.energies()[0],
+                                         0.5 * ( esz.energies()[0] + esz.energies()[1] ),
+                                         esz.energies()[ esz.NES() - 1 ], 1e+3 };
+      std::vector< double > total( 5 ), elastic( 5 ), disappearance( 5 ),
+                            heating( 5 ), indexed( 5 );
+      chunk.evaluate( energies.data(), energies.size(), total.data(),
+                      elastic.data(), disappearance.data(), heating.data() );
+      chunk.evaluate( esz.energyGridIndex(), energies.data(), energies.size(),
+                      indexed.data(), nullptr, nullptr, nullptr );
+
+      THEN( "the values are interpolated on the energy grid" ) {
+
+        CHECK_THAT( esz.total()[0], WithinRel( total[0] ) );
+        CHECK_THAT( esz.total()[0], WithinRel( total[1] ) );
+        CHECK_THAT( 0.5 * ( esz.total()[0] + esz.total()[1] ),
+                    WithinRel( total[2] ) );
+        CHECK_THAT( esz.total()[ esz.NES() - 1 ], WithinRel( total[3] ) );
+        CHECK_THAT( esz.total()[ esz.NES() - 1 ], WithinRel( total[4] ) );
+        CHECK_THAT( 0.5 * ( esz.elastic()[0] + esz.elastic()[1] ),
+                    WithinRel( elastic[2] ) );
+        CHECK_THAT( 0.5 * ( esz.disappearance()[0] + esz.disappearance()[1] ),
+                    WithinRel( disappearance[2] ) );
+        CHECK_THAT( 0.5 * ( esz.heating()[0] + esz.heating()[1] ),
+                    WithinRel( heating[2] ) );
+        CHECK( total == indexed );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the cross sections of all reactions are evaluated" ) {
+
+      ContinuousEnergyTable chunk( fromFile( "2003.710nc" ) );
+      const auto& esz = chunk.ESZ();
+      const auto& sig = chunk.SIG();
+      const auto index = esz.energyGridIndex();
+      const std::size_t ntr = sig.NTR();
+
+      std::vector< double > energies = { 1e-12, 1e-6, 0.75, 2.5, 15., 1e+3 };
+      const std::size_t size = energies.size();
+      std::vector< double > single( ntr ), indexed( ntr );
+      std::vector< double > batch( ntr * size );
+      chunk.evaluateReactions( index, energies.data(), size, batch.data() );
+
+      THEN( "the values are interpolated for each reaction" ) {
+
+        for ( std::size_t j = 0; j < size; ++j ) {
+
+          auto location = esz.locate( energies[j] );
+          chunk.evaluateReactions( energies[j], single.data() );
+          chunk.evaluateReactions( index, energies[j], indexed.data() );
+          for ( std::size_t i = 1; i <= ntr; ++i ) {
+
+            const double expected = sig.crossSectionData( i ).evaluate(
+                                        location.index, location.fraction );
+            CHECK( expected == single[i - 1] );
+            CHECK( expected == indexed[i - 1] );
+            CHECK( expected == batch[ ( i - 1 ) * size + j ] );
+          }
+        }
+      } // THEN
+    } // WHEN
   } // GIVEN
 
   GIVEN( "valid data for a ContinuousEnergyTable - NJOY99 U238" ) {
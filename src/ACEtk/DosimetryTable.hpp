@@ -5,6 +5,7 @@
 
 // other includes
 #include "ACEtk/Table.hpp"
+#include "ACEtk/BlockSelection.hpp"
 #include "ACEtk/continuous/ReactionNumberBlock.hpp"
 #include "ACEtk/dosimetry/CrossSectionBlock.hpp"
 
@@ -19,7 +20,31 @@ namespace ACEtk {
  */
 class DosimetryTable : protected Table {
 
+public:
+
+  /* type aliases */
+
+  /**
+   *  @brief The blocks of the table that can be selected for loading
+   */
+  enum class Block : unsigned int {
+
+    MTR = 0, SIGD
+  };
+  using BlockSelection = ACEtk::BlockSelection< Block >;
+
+  /**
+   *  @brief Combine two blocks into a block selection
+   */
+  friend constexpr BlockSelection operator|( Block left, Block right ) {
+
+    return BlockSelection( left ) | right;
+  }
+
+private:
+
   /* fields */
+  BlockSelection blocks_;
   continuous::MTR mtr_;
   dosimetry::SIGD sig_;
 
@@ -32,21 +57,33 @@ class DosimetryTable : protected Table {
     auto sig = begin + this->data().JXS(7) - 1;
     auto end = this->data().XSS().end();
 
-    this->mtr_ = continuous::MTR( mtr, lsig, this->NTR() );
-    this->sig_ = dosimetry::SIGD( lsig, sig, end, this->NTR() );
+    this->mtr_ = this->blocks_.contains( Block::MTR )
+                 ? continuous::MTR( mtr, lsig, this->NTR() )
+                 : continuous::MTR();
+    this->sig_ = this->blocks_.contains( Block::SIGD )
+                 ? dosimetry::SIGD( lsig, sig, end, this->NTR() )
+                 : dosimetry::SIGD();
   }
 
   #include "ACEtk/DosimetryTable/src/generateData.hpp"
   #include "ACEtk/DosimetryTable/src/verifyType.hpp"
+  #include "ACEtk/DosimetryTable/src/verifyBlock.hpp"
 
 public:
 
   #include "ACEtk/DosimetryTable/src/ctor.hpp"
 
   using Table::header;
-  using Table::data;
   using Table::print;
 
+  /**
+   *  @brief Return the data arrays
+   *
+   *  The blocks of the table refer to the XSS array so only const access to
+   *  the data arrays is provided.
+   */
+  const Data& data() const { return Table::data(); }
+
   //! @todo projectile() function
   //! @todo target() function
 
@@ -129,7 +166,11 @@ public:
   /**
    *  @brief Return the reaction number block
    */
-  const continuous::MTR& MTR() const { return this->mtr_; }
+  const continuous::MTR& MTR() const {
+
+    this->verifyBlock( Block::MTR );
+    return this->mtr_;
+  }
 
   /**
    *  @brief Return the reaction number block
@@ -139,7 +180,11 @@ public:
   /**
    *  @brief Return the cross section block
    */
-  const dosimetry::SIGD& SIGD() const { return this->sig_; }
+  const dosimetry::SIGD& SIGD() const {
+
+    this->verifyBlock( Block::SIGD );
+    return this->sig_;
+  }
 
   /**
    *  @brief Return the cross section block
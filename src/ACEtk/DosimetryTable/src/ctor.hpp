@@ -1,9 +1,15 @@
 /**
  *  @brief Copy constructor using a generic table
  *
+ *  Only the selected blocks are generated. Requesting a block that was not
+ *  selected results in an exception.
+ *
  *  @param[in] table    the generic table to be copied
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-DosimetryTable( const Table& table ): Table( table ) {
+DosimetryTable( const Table& table,
+                BlockSelection blocks = BlockSelection::all() ) :
+  Table( table ), blocks_( blocks ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -12,9 +18,15 @@ DosimetryTable( const Table& table ): Table( table ) {
 /**
  *  @brief Move constructor using a generic table
  *
+ *  Only the selected blocks are generated. Requesting a block that was not
+ *  selected results in an exception.
+ *
  *  @param[in] table    the generic table to be moved
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-DosimetryTable( Table&& table ): Table( std::move( table ) ) {
+DosimetryTable( Table&& table,
+                BlockSelection blocks = BlockSelection::all() ) :
+  Table( std::move( table ) ), blocks_( blocks ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -26,7 +38,7 @@ DosimetryTable( Table&& table ): Table( std::move( table ) ) {
  *  @param[in] table    the dosimetry table to be copied
  */
 DosimetryTable( const DosimetryTable& dostable ) :
-  Table( dostable ) {
+  Table( dostable ), blocks_( dostable.blocks_ ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -38,7 +50,7 @@ DosimetryTable( const DosimetryTable& dostable ) :
  *  @param[in] table    the dosimetry table to be moved
  */
 DosimetryTable( DosimetryTable&& dostable ) :
-  Table( std::move( dostable ) ) {
+  Table( std::move( dostable ) ), blocks_( dostable.blocks_ ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -54,6 +66,7 @@ DosimetryTable& operator=( const DosimetryTable& base ) {
   if ( this != &base ) {
 
     Table::operator=( base );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
@@ -70,6 +83,7 @@ DosimetryTable& operator=( DosimetryTable&& base ) {
   if ( this != &base ) {
 
     Table::operator=( std::move( base ) );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
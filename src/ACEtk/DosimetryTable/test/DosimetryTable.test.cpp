@@ -43,6 +43,11 @@ SCENARIO( "DosimetryTable" ){
 
         verifyChunk( copy );
       } // THEN
+
+      THEN( "the XSS array is shared with the original table" ) {
+
+        CHECK( chunk.data().sharedXSS() == copy.data().sharedXSS() );
+      } // THEN
     } // WHEN
 
     WHEN( "constructing a DosimetryTable using the move constructor" ) {
@@ -83,6 +88,22 @@ SCENARIO( "DosimetryTable" ){
       } // THEN
     } // WHEN
 
+    WHEN( "constructing a DosimetryTable with a block selection" ) {
+
+      DosimetryTable chunk( fromFile( "13027.24y" ), DosimetryTable::Block::MTR );
+      DosimetryTable copy( chunk );
+
+      THEN( "only the selected blocks are available" ) {
+
+        CHECK( 2 == chunk.MTR().MTs().size() );
+        CHECK( 103 == chunk.MTR().MTs().front() );
+        CHECK( 107 == chunk.MTR().MTs().back() );
+        CHECK( 2 == copy.MTR().MTs().size() );
+        CHECK_THROWS( chunk.SIGD() );
+        CHECK_THROWS( copy.SIGD() );
+      } // THEN
+    } // WHEN
+
     WHEN( "constructing a DosimetryTable from scratch" ) {
 
       unsigned int z = 13;
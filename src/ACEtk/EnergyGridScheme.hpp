@@ -0,0 +1,20 @@
+#ifndef NJOY_ACETK_ENERGYGRIDSCHEME
+#define NJOY_ACETK_ENERGYGRIDSCHEME
+
+// system includes
+
+// other includes
+
+namespace njoy {
+namespace ACEtk {
+
+  enum class EnergyGridScheme : short {
+
+    Unionized,  // a unionized grid with an index map for every nuclide
+    Hashed      // a unionized grid with a lethargy hash for every nuclide
+  };
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
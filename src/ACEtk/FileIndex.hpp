@@ -0,0 +1,180 @@
+#ifndef NJOY_ACETK_FILEINDEX
+#define NJOY_ACETK_FILEINDEX
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/BinaryIO.hpp"
+#include "ACEtk/LineIndex.hpp"
+#include "ACEtk/MappedFile.hpp"
+#include "ACEtk/State.hpp"
+#include "ACEtk/Table.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief An index of the tables in a concatenated (type 1) ACE file
+ *
+ *  The file index contains the line index of the file, and the byte offsets
+ *  of the start of each table, the start of its XSS array and the end of the
+ *  table together with the summary of the table (its header, IZAW, NXS and
+ *  JXS arrays).
+ *
+ *  An index can be stored next to the ACE file in a sidecar file (the name
+ *  of the ACE file with the ".acetk-index" extension) so that the file does
+ *  not need to be scanned again. A sidecar index is only used when the size
+ *  and modification time of the file are unchanged and when its hash still
+ *  matches. The hash covers the first and last 64 kB of the file and the
+ *  header and IZAW, NXS and JXS lines of every table, so it can be verified
+ *  without reading the XSS arrays.
+ *
+ *  Sidecar indices are opt-in: they are only written by FileIndex::fromFile
+ *  (or explicitly using toSidecar), never by the functions reading ACE
+ *  files. When a matching sidecar index exists, it is used by
+ *  peekConcatenatedFile (and thus Xsdir::fromDirectory), by the
+ *  multithreaded fromConcatenatedFile and fromMappedConcatenatedFile and by
+ *  Xsdir::load. The sequential readers parse every table anyway and do not
+ *  consult it.
+ *
+ *  A sidecar index consists of:
+ *    - the magic string "ACEtkIDX", the format version and a byte order
+ *      marker (4 byte integers)
+ *    - the size, modification time and hash of the file (8 byte integers)
+ *    - the line index: stride, number of lines, number of offsets and the
+ *      offsets (8 byte integers)
+ *    - the number of tables followed by the tables: line number, byte
+ *      offsets, the length of the header text, the header text, the IZ
+ *      array (16 integers of 4 bytes), the AW array (16 reals of 8 bytes),
+ *      the NXS and JXS arrays (integers of 8 bytes)
+ */
+class FileIndex {
+
+public:
+
+  /**
+   *  @class
+   *  @brief The index information of a single table
+   */
+  struct Entry {
+
+    /** @brief The summary of the table (which includes the line number) */
+    Table::Summary summary;
+
+    /** @brief The byte offset of the start of the table */
+    std::size_t begin;
+
+    /** @brief The byte offset of the start of the XSS array */
+    std::size_t xss;
+
+    /** @brief The byte offset of the end of the table */
+    std::size_t end;
+  };
+
+private:
+
+  /* fields */
+  std::uint64_t size_ = 0;
+  std::int64_t time_ = 0;
+  std::uint64_t hash_ = 0;
+  LineIndex lines_;
+  std::vector< Entry > tables_;
+
+  /* auxiliary functions */
+  #include "ACEtk/FileIndex/src/scan.hpp"
+
+public:
+
+  /* constructor */
+  #include "ACEtk/FileIndex/src/ctor.hpp"
+
+  /**
+   *  @brief Return the magic string identifying a sidecar index
+   */
+  static constexpr const char* magic() { return "ACEtkIDX"; }
+
+  /**
+   *  @brief Return the sidecar index format version
+   */
+  static constexpr std::uint32_t version() { return 1; }
+
+  /**
+   *  @brief Return the name of the sidecar index for an ACE file
+   *
+   *  @param[in] filename   the name of the ACE file
+   */
+  static std::string sidecar( const std::string& filename ) {
+
+    return filename + ".acetk-index";
+  }
+
+  /**
+   *  @brief Return the name of the temporary file used while writing the
+   *         sidecar index for an ACE file
+   *
+   *  @param[in] filename   the name of the ACE file
+   */
+  static std::string temporarySidecar( const std::string& filename ) {
+
+    return sidecar( filename ) + ".tmp";
+  }
+
+  #include "ACEtk/FileIndex/src/modificationTime.hpp"
+  #include "ACEtk/FileIndex/src/hash.hpp"
+
+  /**
+   *  @brief Return the size of the indexed file (in bytes)
+   */
+  std::uint64_t size() const { return this->size_; }
+
+  /**
+   *  @brief Return the modification time of the indexed file
+   */
+  std::int64_t modificationTime() const { return this->time_; }
+
+  /**
+   *  @brief Return the hash of the indexed file
+   */
+  std::uint64_t hash() const { return this->hash_; }
+
+  /**
+   *  @brief Return the line index of the file
+   */
+  const LineIndex& lines() const { return this->lines_; }
+
+  /**
+   *  @brief Return the index information of the tables in the file
+   */
+  const std::vector< Entry >& tables() const { return this->tables_; }
+
+  /**
+   *  @brief Return the number of tables in the file
+   */
+  std::size_t numberTables() const { return this->tables_.size(); }
+
+  #include "ACEtk/FileIndex/src/matches.hpp"
+  #include "ACEtk/FileIndex/src/read.hpp"
+  #include "ACEtk/FileIndex/src/write.hpp"
+  #include "ACEtk/FileIndex/src/fromSidecar.hpp"
+  #include "ACEtk/FileIndex/src/toSidecar.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
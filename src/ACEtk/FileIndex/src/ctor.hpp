@@ -0,0 +1,50 @@
+FileIndex() = default;
+FileIndex( const FileIndex& ) = default;
+FileIndex( FileIndex&& ) = default;
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] size     the size of the indexed file (in bytes)
+ *  @param[in] time     the modification time of the indexed file
+ *  @param[in] hash     the hash of the indexed file
+ *  @param[in] lines    the line index of the file
+ *  @param[in] tables   the index information of the tables in the file
+ */
+FileIndex( std::uint64_t size, std::int64_t time, std::uint64_t hash,
+           LineIndex lines, std::vector< Entry > tables ) :
+  size_( size ), time_( time ), hash_( hash ), lines_( std::move( lines ) ),
+  tables_( std::move( tables ) ) {}
+
+/**
+ *  @brief Constructor (from a mapped file)
+ *
+ *  The file is scanned to construct the index. The XSS arrays are skipped
+ *  without being read.
+ *
+ *  @param[in] file   the mapped file
+ */
+FileIndex( const MappedFile& file )
+  try : size_( file.size() ), time_( modificationTime( file.filename() ) ),
+        lines_( file.begin(), file.end() ),
+        tables_( scan( file, lines_ ) ) {
+
+    this->hash_ = hash( file.begin(), file.end(), this->tables_ );
+  }
+  catch( std::exception& e ) {
+
+    Log::info( "Error while indexing the ACE file \'{}\'", file.filename() );
+    throw e;
+  }
+
+/**
+ *  @brief Constructor (from a file)
+ *
+ *  The file is scanned to construct the index, a sidecar index is not used.
+ *
+ *  @param[in] filename   the file name
+ */
+FileIndex( const std::string& filename ) : FileIndex( MappedFile( filename ) ) {}
+
+FileIndex& operator=( const FileIndex& ) = default;
+FileIndex& operator=( FileIndex&& ) = default;
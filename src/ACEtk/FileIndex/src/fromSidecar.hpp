@@ -0,0 +1,59 @@
+/**
+ *  @brief Read the sidecar index of an ACE file
+ *
+ *  The sidecar index is only returned if it exists and if it still matches
+ *  the ACE file. A sidecar index that cannot be read is ignored.
+ *
+ *  @param[in] filename   the name of the ACE file
+ */
+static std::optional< FileIndex > fromSidecar( const std::string& filename ) {
+
+  std::error_code error;
+  if ( not std::filesystem::exists( sidecar( filename ), error ) ) {
+
+    return std::nullopt;
+  }
+
+  try {
+
+    MappedFile index( sidecar( filename ) );
+    auto result = read( index.begin(), index.end() );
+    if ( result.matches( MappedFile( filename ) ) ) {
+
+      return result;
+    }
+  }
+  catch ( std::exception& ) {
+
+    Log::info( "Ignoring the sidecar index for \'{}\'", filename );
+  }
+  return std::nullopt;
+}
+
+/**
+ *  @brief Return the index of an ACE file, using or creating its sidecar index
+ *
+ *  When the ACE file has no matching sidecar index, the file is scanned and
+ *  the resulting index is written as its sidecar index (if the sidecar index
+ *  cannot be written, the index is still returned).
+ *
+ *  @param[in] filename   the name of the ACE file
+ */
+static FileIndex fromFile( const std::string& filename ) {
+
+  if ( auto index = fromSidecar( filename ) ) {
+
+    return std::move( index.value() );
+  }
+
+  FileIndex index( filename );
+  try {
+
+    index.toSidecar( filename );
+  }
+  catch ( std::exception& ) {
+
+    Log::info( "The sidecar index for \'{}\' could not be written", filename );
+  }
+  return index;
+}
@@ -0,0 +1,38 @@
+/**
+ *  @brief Calculate the hash of an indexed file
+ *
+ *  The hash is a 64-bit FNV-1a hash over the first and last 64 kB of the
+ *  file and over the header, IZAW, NXS and JXS lines of every table.
+ *
+ *  @param[in] begin    a pointer to the first character of the file
+ *  @param[in] end      a pointer past the last character of the file
+ *  @param[in] tables   the index information of the tables in the file
+ */
+static std::uint64_t hash( const char* begin, const char* end,
+                           const std::vector< Entry >& tables ) {
+
+  std::uint64_t value = 0xcbf29ce484222325;
+  auto update = [&value] ( const char* first, const char* last ) {
+
+    for ( ; first < last; ++first ) {
+
+      value ^= static_cast< unsigned char >( *first );
+      value *= 0x100000001b3;
+    }
+  };
+
+  const std::size_t size = end - begin;
+  const std::size_t block = 65536;
+  update( begin, begin + std::min( size, block ) );
+  update( end - std::min( size, block ), end );
+  for ( const auto& table : tables ) {
+
+    if ( ( table.begin > table.xss ) || ( table.xss > size ) ) {
+
+      Log::error( "The table offsets are not consistent with the file" );
+      throw std::exception();
+    }
+    update( begin + table.begin, begin + table.xss );
+  }
+  return value;
+}
@@ -0,0 +1,27 @@
+/**
+ *  @brief Verify that the index matches a mapped file
+ *
+ *  The size and modification time of the file are compared first and the
+ *  hash is only calculated when they match.
+ *
+ *  @param[in] file   the mapped file
+ */
+bool matches( const MappedFile& file ) const {
+
+  if ( ( this->size() != file.size() ) ||
+       ( this->lines().size() != file.size() ) ||
+       ( this->modificationTime() != modificationTime( file.filename() ) ) ) {
+
+    return false;
+  }
+
+  for ( const auto& table : this->tables() ) {
+
+    if ( ( table.begin > table.xss ) || ( table.xss > table.end ) ||
+         ( table.end > file.size() ) ) {
+
+      return false;
+    }
+  }
+  return this->hash() == hash( file.begin(), file.end(), this->tables() );
+}
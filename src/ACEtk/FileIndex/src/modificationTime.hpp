@@ -0,0 +1,17 @@
+/**
+ *  @brief Return the modification time of a file
+ *
+ *  @param[in] filename   the file name
+ */
+static std::int64_t modificationTime( const std::string& filename ) {
+
+  std::error_code error;
+  const auto time = std::filesystem::last_write_time( filename, error );
+  if ( error ) {
+
+    Log::error( "Could not determine the modification time of file \'{}\'",
+                filename );
+    throw std::exception();
+  }
+  return static_cast< std::int64_t >( time.time_since_epoch().count() );
+}
@@ -0,0 +1,91 @@
+/**
+ *  @brief Read an index from a buffer
+ *
+ *  @param[in] begin   the start of the index
+ *  @param[in] end     the end of the index
+ */
+static FileIndex read( const char* begin, const char* end ) {
+
+  const char* position = begin;
+  if ( ( end - begin < 40 ) || ( std::string( begin, 8 ) != magic() ) ) {
+
+    Log::error( "The buffer does not contain an ACE file index" );
+    throw std::exception();
+  }
+  position += 8;
+
+  const auto format = BinaryIO::unpack< std::uint32_t >( position, end );
+  const auto order = BinaryIO::unpack< std::uint32_t >( position, end );
+  if ( format != version() ) {
+
+    Log::error( "The ACE file index has an unsupported format version" );
+    Log::info( "Format version: {}", format );
+    Log::info( "Supported format version: {}", version() );
+    throw std::exception();
+  }
+  if ( order != 0x01020304 ) {
+
+    Log::error( "The ACE file index was written on a machine with a "
+                "different byte order" );
+    throw std::exception();
+  }
+
+  const auto size = BinaryIO::unpack< std::uint64_t >( position, end );
+  const auto time = BinaryIO::unpack< std::int64_t >( position, end );
+  const auto hash = BinaryIO::unpack< std::uint64_t >( position, end );
+
+  // line index
+  const auto stride = BinaryIO::unpack< std::uint64_t >( position, end );
+  const auto buffer = BinaryIO::unpack< std::uint64_t >( position, end );
+  const auto number = BinaryIO::unpack< std::uint64_t >( position, end );
+  const auto count = BinaryIO::unpack< std::uint64_t >( position, end );
+  if ( count > static_cast< std::size_t >( end - position ) / 8 ) {
+
+    Log::error( "The ACE file index is truncated" );
+    throw std::exception();
+  }
+  std::vector< std::size_t > offsets( count );
+  for ( auto& offset : offsets ) {
+
+    offset = BinaryIO::unpack< std::uint64_t >( position, end );
+  }
+
+  // tables
+  const auto tables = BinaryIO::unpack< std::uint64_t >( position, end );
+  std::vector< Entry > entries;
+  for ( std::uint64_t i = 0; i < tables; ++i ) {
+
+    const auto line = BinaryIO::unpack< std::int64_t >( position, end );
+    const auto first = BinaryIO::unpack< std::uint64_t >( position, end );
+    const auto xss = BinaryIO::unpack< std::uint64_t >( position, end );
+    const auto last = BinaryIO::unpack< std::uint64_t >( position, end );
+    const auto length = BinaryIO::unpack< std::uint64_t >( position, end );
+    if ( length > static_cast< std::size_t >( end - position ) ) {
+
+      Log::error( "The ACE file index is truncated" );
+      throw std::exception();
+    }
+    State< const char* > state{ 1, position, position + length };
+    auto header = Table::readHeader( state );
+    position += length;
+
+    std::pair< std::array< int32_t, 16 >, std::array< double, 16 > > izaw;
+    std::array< int64_t, 16 > nxs;
+    std::array< int64_t, 32 > jxs;
+    for ( auto& value : izaw.first ) { value = BinaryIO::unpack< std::int32_t >( position, end ); }
+    for ( auto& value : izaw.second ) { value = BinaryIO::unpack< double >( position, end ); }
+    for ( auto& value : nxs ) { value = BinaryIO::unpack< std::int64_t >( position, end ); }
+    for ( auto& value : jxs ) { value = BinaryIO::unpack< std::int64_t >( position, end ); }
+
+    entries.push_back(
+        { Table::Summary( line, std::move( header ),
+                          Table::Data( std::move( izaw ), std::move( nxs ),
+                                       std::move( jxs ),
+                                       std::vector< double >{} ) ),
+          first, xss, last } );
+  }
+
+  return FileIndex( size, time, hash,
+                    LineIndex( stride, buffer, number, std::move( offsets ) ),
+                    std::move( entries ) );
+}
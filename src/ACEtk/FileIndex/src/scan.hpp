@@ -0,0 +1,28 @@
+/**
+ *  @brief Find the tables in a mapped file
+ *
+ *  @param[in] file    the mapped file
+ *  @param[in] lines   the line index of the file
+ */
+static std::vector< Entry > scan( const MappedFile& file,
+                                  const LineIndex& lines ) {
+
+  std::vector< Entry > tables;
+  State< const char* > state{ 1, file.begin(), file.end() };
+  while ( state.position != state.end ) {
+
+    const std::size_t begin = state.position - file.begin();
+    Table::Summary summary( state );
+    const std::size_t end = state.position - file.begin();
+
+    // the XSS array starts on the first line after the JXS array
+    const long length = summary.data().NXS(1);
+    const std::size_t xss = length > 0
+                            ? lines.offset( file.begin(),
+                                            state.lineNumber - ( length + 3 ) / 4 )
+                            : end;
+
+    tables.push_back( { std::move( summary ), begin, xss, end } );
+  }
+  return tables;
+}
@@ -0,0 +1,31 @@
+/**
+ *  @brief Write the index as the sidecar index of an ACE file
+ *
+ *  The index is written to a temporary file first which is then renamed, so
+ *  that concurrent readers never see a partially written sidecar index.
+ *
+ *  @param[in] filename   the name of the ACE file
+ */
+void toSidecar( const std::string& filename ) const {
+
+  const std::string target = sidecar( filename );
+  const std::string temporary = temporarySidecar( filename );
+  {
+    std::ofstream out( temporary, std::ios::out | std::ios::binary );
+    if ( not out ) {
+
+      Log::error( "Could not open file \'{}\'", temporary );
+      throw std::exception();
+    }
+    this->write( out );
+  }
+
+  std::error_code error;
+  std::filesystem::rename( temporary, target, error );
+  if ( error ) {
+
+    std::filesystem::remove( temporary, error );
+    Log::error( "Could not write file \'{}\'", target );
+    throw std::exception();
+  }
+}
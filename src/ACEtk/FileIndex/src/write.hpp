@@ -0,0 +1,53 @@
+/**
+ *  @brief Write the index
+ *
+ *  @param[in] out   the output stream (opened in binary mode)
+ */
+void write( std::ostream& out ) const {
+
+  out.write( magic(), 8 );
+  BinaryIO::pack( out, version() );
+  BinaryIO::pack( out, std::uint32_t{ 0x01020304 } );
+  BinaryIO::pack( out, std::uint64_t{ this->size() } );
+  BinaryIO::pack( out, std::int64_t{ this->modificationTime() } );
+  BinaryIO::pack( out, std::uint64_t{ this->hash() } );
+
+  // line index
+  BinaryIO::pack( out, std::uint64_t{ this->lines().stride() } );
+  BinaryIO::pack( out, std::uint64_t{ this->lines().size() } );
+  BinaryIO::pack( out, std::uint64_t{ this->lines().numberLines() } );
+  BinaryIO::pack( out, std::uint64_t{ this->lines().offsets().size() } );
+  for ( auto offset : this->lines().offsets() ) {
+
+    BinaryIO::pack( out, std::uint64_t{ offset } );
+  }
+
+  // tables
+  BinaryIO::pack( out, std::uint64_t{ this->numberTables() } );
+  for ( const auto& table : this->tables() ) {
+
+    std::ostringstream header;
+    std::visit( [&header] ( const auto& value ) { value.print( header ); },
+                table.summary.header() );
+    const std::string text = header.str();
+
+    BinaryIO::pack( out, std::int64_t{ table.summary.lineNumber() } );
+    BinaryIO::pack( out, std::uint64_t{ table.begin } );
+    BinaryIO::pack( out, std::uint64_t{ table.xss } );
+    BinaryIO::pack( out, std::uint64_t{ table.end } );
+    BinaryIO::pack( out, std::uint64_t{ text.size() } );
+    out.write( text.data(), text.size() );
+
+    const auto& data = table.summary.data();
+    for ( auto value : data.IZ() ) { BinaryIO::pack( out, std::int32_t{ value } ); }
+    for ( auto value : data.AW() ) { BinaryIO::pack( out, value ); }
+    for ( auto value : data.NXS() ) { BinaryIO::pack( out, std::int64_t{ value } ); }
+    for ( auto value : data.JXS() ) { BinaryIO::pack( out, std::int64_t{ value } ); }
+  }
+
+  if ( not out ) {
+
+    Log::error( "Could not write the ACE file index" );
+    throw std::exception();
+  }
+}
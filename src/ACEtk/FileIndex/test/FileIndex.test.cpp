@@ -0,0 +1,271 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/FileIndex.hpp"
+
+// other includes
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "ACEtk/fromFile.hpp"
+#include "ACEtk/fromMappedFile.hpp"
+#include "ACEtk/peekHeader.hpp"
+#include "ACEtk/Xsdir.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+std::string chunk();
+std::string chunkWith201Header();
+void writeFile( const std::string&, const std::string& );
+void verifyIndex( const FileIndex& );
+void verifyChunk( const Table& );
+
+SCENARIO( "FileIndex" ) {
+
+  GIVEN( "a concatenated ACE file" ) {
+
+    std::string string = chunk() + chunkWith201Header() + chunk();
+    std::filesystem::remove( FileIndex::sidecar( "indexed.ace" ) );
+    writeFile( "indexed.ace", string );
+
+    WHEN( "the file is indexed" ) {
+
+      FileIndex index( "indexed.ace" );
+
+      THEN( "the index is correct" ) {
+
+        verifyIndex( index );
+        CHECK( true == index.matches( MappedFile( "indexed.ace" ) ) );
+        CHECK( false == std::filesystem::exists( FileIndex::sidecar( "indexed.ace" ) ) );
+      } // THEN
+
+      THEN( "the index can be written and read" ) {
+
+        std::ostringstream out;
+        index.write( out );
+        std::string buffer = out.str();
+        FileIndex copy = FileIndex::read( buffer.data(), buffer.data() + buffer.size() );
+
+        verifyIndex( copy );
+        CHECK( index.hash() == copy.hash() );
+        CHECK( index.modificationTime() == copy.modificationTime() );
+        CHECK( index.lines().offsets() == copy.lines().offsets() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the file is read without a sidecar index" ) {
+
+      auto tables = fromConcatenatedFile( "indexed.ace", 2 );
+      auto summaries = peekConcatenatedFile( "indexed.ace" );
+
+      THEN( "no sidecar index is created" ) {
+
+        CHECK( 3 == tables.size() );
+        CHECK( 3 == summaries.size() );
+        CHECK( false == std::filesystem::exists( FileIndex::sidecar( "indexed.ace" ) ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the sidecar index is used" ) {
+
+      CHECK( std::nullopt == FileIndex::fromSidecar( "indexed.ace" ) );
+      FileIndex index = FileIndex::fromFile( "indexed.ace" );
+      auto sidecar = FileIndex::fromSidecar( "indexed.ace" );
+
+      THEN( "the sidecar index is created and reused" ) {
+
+        CHECK( true == std::filesystem::exists( FileIndex::sidecar( "indexed.ace" ) ) );
+        CHECK( sidecar.has_value() );
+        verifyIndex( index );
+        verifyIndex( sidecar.value() );
+        CHECK( index.hash() == sidecar->hash() );
+      } // THEN
+
+      THEN( "tables can be read using the sidecar index" ) {
+
+        auto tables = fromConcatenatedFile( "indexed.ace", 2 );
+        auto mapped = fromMappedConcatenatedFile( "indexed.ace", 2 );
+
+        CHECK( 3 == tables.size() );
+        CHECK( 3 == mapped.size() );
+        CHECK( true == std::holds_alternative< Table::Header201 >( tables[1].header() ) );
+        CHECK( true == std::holds_alternative< Table::Header201 >( mapped[1].header() ) );
+        for ( unsigned int i = 0; i < 3; ++i ) {
+
+          verifyChunk( tables[i] );
+          verifyChunk( mapped[i] );
+        }
+
+        Xsdir xsdir( {}, { XsdirEntry( "92238.800nc", 236.0058, "indexed.ace", 15, 6 ) } );
+        verifyChunk( xsdir.load( "92238.800nc" ) );
+      } // THEN
+
+      THEN( "the summaries can be read using the sidecar index" ) {
+
+        auto summaries = peekConcatenatedFile( "indexed.ace" );
+
+        CHECK( 3 == summaries.size() );
+        for ( unsigned int i = 0; i < 3; ++i ) {
+
+          CHECK( index.tables()[i].summary.lineNumber() == summaries[i].lineNumber() );
+          CHECK( index.tables()[i].summary.ZAID() == summaries[i].ZAID() );
+          CHECK( index.tables()[i].summary.length() == summaries[i].length() );
+        }
+        CHECK( true == std::holds_alternative< Table::Header201 >( summaries[1].header() ) );
+      } // THEN
+
+      THEN( "a sidecar index that does not match the file is not used" ) {
+
+        // same size, different content
+        std::string changed = string;
+        changed[ chunk().size() + 25 ] = '4';
+        writeFile( "indexed.ace", changed );
+        CHECK( std::nullopt == FileIndex::fromSidecar( "indexed.ace" ) );
+
+        // different size
+        writeFile( "indexed.ace", chunk() + chunk() );
+        CHECK( std::nullopt == FileIndex::fromSidecar( "indexed.ace" ) );
+        auto tables = fromConcatenatedFile( "indexed.ace", 2 );
+        CHECK( 2 == tables.size() );
+        CHECK( 2 == FileIndex::fromFile( "indexed.ace" ).numberTables() );
+        CHECK( 2 == FileIndex::fromSidecar( "indexed.ace" )->numberTables() );
+      } // THEN
+
+      THEN( "an invalid sidecar index is not used" ) {
+
+        writeFile( FileIndex::sidecar( "indexed.ace" ), "ACEtkIDX" );
+        CHECK( std::nullopt == FileIndex::fromSidecar( "indexed.ace" ) );
+        CHECK( 3 == fromConcatenatedFile( "indexed.ace", 2 ).size() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    WHEN( "the file does not exist" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( FileIndex( "not-a-file.ace" ) );
+        CHECK_THROWS( FileIndex::fromFile( "not-a-file.ace" ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the buffer is not an index" ) {
+
+      std::string buffer = "not an index, but long enough to have a preamble";
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( FileIndex::read( buffer.data(), buffer.data() + buffer.size() ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+void writeFile( const std::string& filename, const std::string& content ) {
+
+  std::ofstream out( filename, std::ios::binary );
+  out << content;
+}
+
+void verifyIndex( const FileIndex& index ) {
+
+  const std::size_t first = chunk().size();
+  const std::size_t second = chunkWith201Header().size();
+  const std::size_t xss = 122;
+
+  CHECK( 2 * first + second == index.size() );
+  CHECK( 2 * first + second == index.lines().size() );
+  CHECK( 44 == index.lines().numberLines() );
+  CHECK( 3 == index.numberTables() );
+
+  const auto& tables = index.tables();
+  CHECK( 1 == tables[0].summary.lineNumber() );
+  CHECK( 0 == tables[0].begin );
+  CHECK( first - xss == tables[0].xss );
+  CHECK( first == tables[0].end );
+  CHECK( "92238.80c" == tables[0].summary.ZAID() );
+
+  CHECK( 15 == tables[1].summary.lineNumber() );
+  CHECK( first == tables[1].begin );
+  CHECK( first + second - xss == tables[1].xss );
+  CHECK( first + second == tables[1].end );
+  CHECK( "92238.800nc" == tables[1].summary.ZAID() );
+  CHECK( true == std::holds_alternative< Table::Header201 >( tables[1].summary.header() ) );
+
+  CHECK( 31 == tables[2].summary.lineNumber() );
+  CHECK( first + second == tables[2].begin );
+  CHECK( 2 * first + second - xss == tables[2].xss );
+  CHECK( 2 * first + second == tables[2].end );
+
+  for ( const auto& table : tables ) {
+
+    CHECK_THAT( 236.0058, WithinRel( table.summary.AWR() ) );
+    CHECK_THAT( 2.5301e-8, WithinRel( table.summary.TEMP() ) );
+    CHECK( 6 == table.summary.length() );
+    CHECK( 33074 == table.summary.data().NXS(2) );
+    CHECK( 8 == table.summary.data().JXS(32) );
+    CHECK_THAT( 15., WithinRel( table.summary.data().AW(1) ) );
+  }
+}
+
+std::string chunk() {
+
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWith201Header() {
+
+  return
+    "2.0.1                   92238.800nc            ENDF/B-VIII.0\n"
+    "  236.005800   2.5301E-08 2018-05-01          2\n"
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+void verifyChunk( const Table& chunk ) {
+
+  CHECK( 6 == chunk.data().NXS(1) );
+  CHECK( 33074 == chunk.data().NXS(2) );
+  CHECK( 1 == chunk.data().JXS(1) );
+  CHECK( 8 == chunk.data().JXS(32) );
+
+  CHECK( 6 == chunk.data().XSS().size() );
+  CHECK_THAT( 1.00000000000E+00, WithinRel( chunk.data().XSS(1) ) );
+  CHECK_THAT( 1.03125000000E+00, WithinRel( chunk.data().XSS(2) ) );
+  CHECK_THAT( 1.06250000000E+00, WithinRel( chunk.data().XSS(3) ) );
+  CHECK_THAT( 1.09375000000E+00, WithinRel( chunk.data().XSS(4) ) );
+  CHECK_THAT( 1.12500000000E+00, WithinRel( chunk.data().XSS(5) ) );
+  CHECK_THAT( 1.15625000000E+00, WithinRel( chunk.data().XSS(6) ) );
+}
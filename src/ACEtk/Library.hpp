@@ -0,0 +1,180 @@
+#ifndef NJOY_ACETK_LIBRARY
+#define NJOY_ACETK_LIBRARY
+
+// system includes
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/ThreadPool.hpp"
+#include "ACEtk/Xsdir.hpp"
+#include "ACEtk/ContinuousEnergyTable.hpp"
+#include "ACEtk/ThermalScatteringTable.hpp"
+#include "ACEtk/PhotoatomicTable.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A thread safe cache of ACE tables loaded through an xsdir
+ *
+ *  The Library class hands out shared immutable ACE tables (e.g. a
+ *  ContinuousEnergyTable) for a given ZAID. A table is loaded from the files
+ *  referenced in the xsdir the first time it is requested and later requests
+ *  return the same instance. When multiple threads request a table that is
+ *  not loaded yet, the table is only loaded once and all threads receive the
+ *  same instance.
+ *
+ *  The memory used by the cached tables (estimated using the size of their
+ *  XSS array) is kept under a given budget by removing the least recently
+ *  used tables from the cache. Tables removed from the cache remain valid
+ *  for as long as they are in use. A table larger than the budget is still
+ *  cached until another table is loaded.
+ *
+ *  Tables can also be loaded in the background using prefetch(), e.g. while
+ *  the rest of a calculation is being set up.
+ */
+class Library {
+
+public:
+
+  /**
+   *  @class
+   *  @brief The cache statistics of a library
+   */
+  struct Statistics {
+
+    /** @brief The number of requests for a table that was already cached */
+    std::size_t hits = 0;
+
+    /** @brief The number of requests for a table that had to be loaded */
+    std::size_t misses = 0;
+
+    /** @brief The number of tables that were removed from the cache */
+    std::size_t evictions = 0;
+  };
+
+private:
+
+  /* auxiliary types */
+  using Pointer = std::shared_ptr< const void >;
+
+  struct Entry {
+
+    std::shared_future< Pointer > table;
+    std::type_index type;
+    std::uint64_t id;
+    std::size_t bytes = 0;
+    bool ready = false;
+    std::list< std::string >::iterator position;
+  };
+
+  struct Request {
+
+    std::shared_future< Pointer > table;
+    std::optional< std::promise< Pointer > > promise;
+    std::uint64_t id;
+  };
+
+  /* fields */
+  Xsdir xsdir_;
+  std::size_t budget_;
+  mutable std::mutex mutex_;
+  std::unordered_map< std::string, Entry > entries_;
+  std::list< std::string > recent_;
+  std::size_t bytes_ = 0;
+  std::uint64_t next_ = 0;
+  Statistics statistics_;
+
+  // the thread pool is declared last so that it is destroyed (and all its
+  // tasks are finished) before the cache
+  unsigned int threads_;
+  std::once_flag started_;
+  std::unique_ptr< ThreadPool > pool_;
+
+  /* auxiliary functions */
+  #include "ACEtk/Library/src/request.hpp"
+  #include "ACEtk/Library/src/fill.hpp"
+  #include "ACEtk/Library/src/evict.hpp"
+
+public:
+
+  /* constructor */
+  #include "ACEtk/Library/src/ctor.hpp"
+
+  /**
+   *  @brief Return the xsdir of the library
+   */
+  const Xsdir& xsdir() const { return this->xsdir_; }
+
+  /**
+   *  @brief Return the number of threads used to prefetch tables
+   */
+  unsigned int threads() const { return this->threads_; }
+
+  /**
+   *  @brief Return the memory budget of the cache (in bytes)
+   */
+  std::size_t budget() const { return this->budget_; }
+
+  /**
+   *  @brief Return the estimated memory used by the cached tables (in bytes)
+   */
+  std::size_t memory() const {
+
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    return this->bytes_;
+  }
+
+  /**
+   *  @brief Return the number of cached tables (including tables that are
+   *         being loaded)
+   */
+  std::size_t size() const {
+
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    return this->entries_.size();
+  }
+
+  /**
+   *  @brief Return whether or not a table is cached
+   *
+   *  @param[in] zaid   the ZAID of the table
+   */
+  bool contains( const std::string& zaid ) const {
+
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    return this->entries_.find( zaid ) != this->entries_.end();
+  }
+
+  /**
+   *  @brief Return the cache statistics
+   */
+  Statistics statistics() const {
+
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    return this->statistics_;
+  }
+
+  #include "ACEtk/Library/src/get.hpp"
+  #include "ACEtk/Library/src/prefetch.hpp"
+  #include "ACEtk/Library/src/clear.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
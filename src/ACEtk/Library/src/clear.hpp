@@ -0,0 +1,13 @@
+/**
+ *  @brief Remove all tables from the cache
+ *
+ *  Tables that are still being loaded are finished but they are not added
+ *  to the cache. The cache statistics are not reset.
+ */
+void clear() {
+
+  std::lock_guard< std::mutex > lock( this->mutex_ );
+  this->entries_.clear();
+  this->recent_.clear();
+  this->bytes_ = 0;
+}
@@ -0,0 +1,22 @@
+Library( const Library& ) = delete;
+Library( Library&& ) = delete;
+Library& operator=( const Library& ) = delete;
+Library& operator=( Library&& ) = delete;
+
+/**
+ *  @brief Constructor
+ *
+ *  The threads used to prefetch tables are only started when tables are
+ *  prefetched for the first time.
+ *
+ *  @param[in] xsdir     the xsdir to load the tables with
+ *  @param[in] budget    the memory budget of the cache in bytes (default:
+ *                       no limit)
+ *  @param[in] threads   the number of threads used to prefetch tables
+ *                       (default: the hardware concurrency)
+ */
+Library( Xsdir xsdir,
+         std::size_t budget = std::numeric_limits< std::size_t >::max(),
+         unsigned int threads = ThreadPool::defaultSize() ) :
+  xsdir_( std::move( xsdir ) ), budget_( budget ),
+  threads_( std::max( 1u, threads ) ) {}
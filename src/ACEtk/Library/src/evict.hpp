@@ -0,0 +1,28 @@
+/**
+ *  @brief Remove the least recently used tables until the cache fits the
+ *         memory budget
+ *
+ *  Tables that are still being loaded and the given table are never removed.
+ *  The mutex must be locked by the caller.
+ *
+ *  @param[in] keep   the ZAID of the table to keep
+ */
+void evict( const std::string& keep ) {
+
+  auto position = this->recent_.end();
+  while ( ( this->bytes_ > this->budget_ ) &&
+          ( position != this->recent_.begin() ) ) {
+
+    --position;
+    auto iter = this->entries_.find( *position );
+    if ( ( *position == keep ) || ( not iter->second.ready ) ) {
+
+      continue;
+    }
+
+    this->bytes_ -= iter->second.bytes;
+    ++this->statistics_.evictions;
+    position = this->recent_.erase( position );
+    this->entries_.erase( iter );
+  }
+}
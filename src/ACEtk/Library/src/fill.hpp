@@ -0,0 +1,48 @@
+/**
+ *  @brief Load a table and fulfil the promise of a request
+ *
+ *  When the table cannot be loaded, the exception is passed on to everyone
+ *  waiting for the table and the entry is removed from the cache so that a
+ *  later request tries to load it again.
+ *
+ *  @param[in] zaid      the ZAID of the table
+ *  @param[in] promise   the promise to fulfil
+ *  @param[in] id        the identifier of the cache entry
+ */
+template< typename Type >
+void fill( const std::string& zaid, std::promise< Pointer >& promise,
+           std::uint64_t id ) {
+
+  std::shared_ptr< const Type > table;
+  try {
+
+    table = std::make_shared< const Type >( this->xsdir_.load( zaid ) );
+  }
+  catch ( ... ) {
+
+    promise.set_exception( std::current_exception() );
+
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    auto iter = this->entries_.find( zaid );
+    if ( ( iter != this->entries_.end() ) && ( iter->second.id == id ) ) {
+
+      this->recent_.erase( iter->second.position );
+      this->entries_.erase( iter );
+    }
+    return;
+  }
+
+  const std::size_t bytes = sizeof( Type ) +
+                            table->data().XSS().size() * sizeof( double );
+  promise.set_value( std::move( table ) );
+
+  std::lock_guard< std::mutex > lock( this->mutex_ );
+  auto iter = this->entries_.find( zaid );
+  if ( ( iter != this->entries_.end() ) && ( iter->second.id == id ) ) {
+
+    iter->second.bytes = bytes;
+    iter->second.ready = true;
+    this->bytes_ += bytes;
+    this->evict( zaid );
+  }
+}
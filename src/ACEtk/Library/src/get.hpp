@@ -0,0 +1,54 @@
+/**
+ *  @brief Return the ACE table for a given ZAID
+ *
+ *  The table is loaded if it is not cached yet. If another thread is loading
+ *  the same table, this function waits for it instead of loading the table a
+ *  second time.
+ *
+ *  @tparam Type   the type of ACE table (e.g. ContinuousEnergyTable)
+ *
+ *  @param[in] zaid   the ZAID of the table
+ */
+template< typename Type >
+std::shared_ptr< const Type > get( const std::string& zaid ) {
+
+  auto request = this->request( zaid, typeid( Type ) );
+  if ( request.promise ) {
+
+    this->fill< Type >( zaid, request.promise.value(), request.id );
+  }
+  return std::static_pointer_cast< const Type >( request.table.get() );
+}
+
+/**
+ *  @brief Return the continuous energy table for a given ZAID
+ *
+ *  @param[in] zaid   the ZAID of the table
+ */
+std::shared_ptr< const ContinuousEnergyTable >
+continuousEnergyTable( const std::string& zaid ) {
+
+  return this->get< ContinuousEnergyTable >( zaid );
+}
+
+/**
+ *  @brief Return the thermal scattering table for a given ZAID
+ *
+ *  @param[in] zaid   the ZAID of the table
+ */
+std::shared_ptr< const ThermalScatteringTable >
+thermalScatteringTable( const std::string& zaid ) {
+
+  return this->get< ThermalScatteringTable >( zaid );
+}
+
+/**
+ *  @brief Return the photoatomic table for a given ZAID
+ *
+ *  @param[in] zaid   the ZAID of the table
+ */
+std::shared_ptr< const PhotoatomicTable >
+photoatomicTable( const std::string& zaid ) {
+
+  return this->get< PhotoatomicTable >( zaid );
+}
@@ -0,0 +1,33 @@
+/**
+ *  @brief Start loading ACE tables in the background
+ *
+ *  The tables are loaded concurrently on the thread pool of the library and
+ *  added to the cache. The futures can be used to wait for a table (or to
+ *  retrieve the exception thrown while loading it) but they do not need to
+ *  be kept: a later request for a table that is still being loaded waits
+ *  for it instead of loading it again.
+ *
+ *  @tparam Type   the type of ACE table (default: ContinuousEnergyTable)
+ *
+ *  @param[in] zaids   the ZAIDs of the tables
+ */
+template< typename Type = ContinuousEnergyTable >
+std::vector< std::future< std::shared_ptr< const Type > > >
+prefetch( const std::vector< std::string >& zaids ) {
+
+  std::call_once( this->started_, [this] {
+
+    this->pool_ = std::make_unique< ThreadPool >( this->threads_ );
+  } );
+
+  std::vector< std::future< std::shared_ptr< const Type > > > futures;
+  futures.reserve( zaids.size() );
+  for ( const auto& zaid : zaids ) {
+
+    futures.emplace_back( this->pool_->submit( [this, zaid] {
+
+      return this->get< Type >( zaid );
+    } ) );
+  }
+  return futures;
+}
@@ -0,0 +1,38 @@
+/**
+ *  @brief Request a table from the cache
+ *
+ *  If the table is not cached yet, an entry is created and the request
+ *  contains the promise that the caller must fulfil by loading the table.
+ *
+ *  @param[in] zaid   the ZAID of the table
+ *  @param[in] type   the type of the table
+ */
+Request request( const std::string& zaid, std::type_index type ) {
+
+  std::lock_guard< std::mutex > lock( this->mutex_ );
+
+  auto iter = this->entries_.find( zaid );
+  if ( iter != this->entries_.end() ) {
+
+    if ( iter->second.type != type ) {
+
+      Log::error( "The table for \'{}\' was already requested as a different "
+                  "type of ACE table", zaid );
+      throw std::exception();
+    }
+
+    ++this->statistics_.hits;
+    this->recent_.splice( this->recent_.begin(), this->recent_,
+                          iter->second.position );
+    return { iter->second.table, std::nullopt, iter->second.id };
+  }
+
+  ++this->statistics_.misses;
+  std::promise< Pointer > promise;
+  std::shared_future< Pointer > table = promise.get_future().share();
+  this->recent_.push_front( zaid );
+  const std::uint64_t id = this->next_++;
+  this->entries_.emplace( zaid, Entry{ table, type, id, 0, false,
+                                       this->recent_.begin() } );
+  return { std::move( table ), std::move( promise ), id };
+}
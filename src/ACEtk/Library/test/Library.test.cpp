@@ -0,0 +1,222 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ACEtk/Library.hpp"
+
+// other includes
+#include <limits>
+#include <thread>
+#include "ACEtk/peekHeader.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+Xsdir xsdir();
+
+SCENARIO( "Library" ) {
+
+  GIVEN( "a library without a memory budget" ) {
+
+    Library library( xsdir() );
+
+    WHEN( "tables are requested" ) {
+
+      auto helium = library.continuousEnergyTable( "2003.710nc" );
+      auto hydrogen = library.photoatomicTable( "1000.01p" );
+      auto again = library.get< ContinuousEnergyTable >( "2003.710nc" );
+
+      THEN( "the tables are loaded once and shared" ) {
+
+        CHECK( "2003.710nc" == helium->ZAID() );
+        CHECK( "1000.01p" == hydrogen->ZAID() );
+        CHECK( helium.get() == again.get() );
+
+        CHECK( 2 == library.size() );
+        CHECK( true == library.contains( "2003.710nc" ) );
+        CHECK( true == library.contains( "1000.01p" ) );
+        CHECK( false == library.contains( "3000.03p" ) );
+        CHECK( library.memory() > ( helium->length() + hydrogen->length() ) * 8 );
+
+        auto statistics = library.statistics();
+        CHECK( 1 == statistics.hits );
+        CHECK( 2 == statistics.misses );
+        CHECK( 0 == statistics.evictions );
+      } // THEN
+
+      THEN( "the cache can be cleared" ) {
+
+        library.clear();
+        CHECK( 0 == library.size() );
+        CHECK( 0 == library.memory() );
+
+        // tables handed out remain valid
+        CHECK( "2003.710nc" == helium->ZAID() );
+        CHECK( helium.get() != library.continuousEnergyTable( "2003.710nc" ).get() );
+        CHECK( 3 == library.statistics().misses );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a table is requested concurrently" ) {
+
+      std::vector< std::shared_ptr< const ContinuousEnergyTable > > tables( 8 );
+      std::vector< std::thread > threads;
+      for ( unsigned int i = 0; i < tables.size(); ++i ) {
+
+        threads.emplace_back( [&library, &tables, i] {
+
+          tables[i] = library.continuousEnergyTable( "2003.710nc" );
+        } );
+      }
+      for ( auto& thread : threads ) {
+
+        thread.join();
+      }
+
+      THEN( "the table is only loaded once" ) {
+
+        for ( const auto& table : tables ) {
+
+          CHECK( tables.front().get() == table.get() );
+        }
+        CHECK( 1 == library.statistics().misses );
+        CHECK( 7 == library.statistics().hits );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a library with threads to prefetch tables" ) {
+
+    Library library( xsdir(), std::numeric_limits< std::size_t >::max(), 2 );
+
+    WHEN( "tables are prefetched" ) {
+
+      auto helium = library.prefetch( { "2003.710nc" } );
+      auto photoatomic = library.prefetch< PhotoatomicTable >(
+                             { "1000.01p", "3000.03p", "1000.01p" } );
+
+      THEN( "the tables are loaded in the background and cached" ) {
+
+        CHECK( 2 == library.threads() );
+        CHECK( 1 == helium.size() );
+        CHECK( 3 == photoatomic.size() );
+
+        auto table = helium[0].get();
+        auto hydrogen = photoatomic[0].get();
+        auto lithium = photoatomic[1].get();
+        CHECK( "2003.710nc" == table->ZAID() );
+        CHECK( "1000.01p" == hydrogen->ZAID() );
+        CHECK( "3000.03p" == lithium->ZAID() );
+        CHECK( hydrogen.get() == photoatomic[2].get().get() );
+
+        CHECK( 3 == library.size() );
+        CHECK( table.get() == library.continuousEnergyTable( "2003.710nc" ).get() );
+        CHECK( 3 == library.statistics().misses );
+        CHECK( 2 == library.statistics().hits );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a table that cannot be loaded is prefetched" ) {
+
+      auto futures = library.prefetch( { "1001.80c", "2003.710nc" } );
+
+      THEN( "the exception is available through the future" ) {
+
+        CHECK_THROWS( futures[0].get() );
+        CHECK( "2003.710nc" == futures[1].get()->ZAID() );
+        CHECK( false == library.contains( "1001.80c" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a library with a memory budget" ) {
+
+    Library unlimited( xsdir() );
+    const std::size_t one = ( unlimited.photoatomicTable( "1000.01p" ), unlimited.memory() );
+    const std::size_t two = ( unlimited.photoatomicTable( "3000.03p" ), unlimited.memory() ) - one;
+    Library library( xsdir(), one + two - 1 );
+
+    WHEN( "more tables are requested than fit in the budget" ) {
+
+      auto hydrogen = library.photoatomicTable( "1000.01p" );
+      auto lithium = library.photoatomicTable( "3000.03p" );
+
+      THEN( "the least recently used tables are evicted" ) {
+
+        CHECK( one + two - 1 == library.budget() );
+        CHECK( 1 == library.size() );
+        CHECK( false == library.contains( "1000.01p" ) );
+        CHECK( true == library.contains( "3000.03p" ) );
+        CHECK( two == library.memory() );
+        CHECK( 1 == library.statistics().evictions );
+
+        // evicted tables remain valid
+        CHECK( "1000.01p" == hydrogen->ZAID() );
+
+        library.photoatomicTable( "1000.01p" );
+        CHECK( false == library.contains( "3000.03p" ) );
+        CHECK( 2 == library.statistics().evictions );
+        CHECK( 3 == library.statistics().misses );
+      } // THEN
+
+      THEN( "recently used tables are kept" ) {
+
+        Library larger( xsdir(), one + two + 1 );
+        larger.photoatomicTable( "1000.01p" );
+        larger.photoatomicTable( "3000.03p" );
+        larger.photoatomicTable( "1000.01p" );
+        larger.continuousEnergyTable( "2003.710nc" );
+
+        CHECK( false == larger.contains( "3000.03p" ) );
+        CHECK( true == larger.contains( "2003.710nc" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    Library library( xsdir() );
+
+    WHEN( "a table is not in the xsdir" ) {
+
+      THEN( "an exception is thrown and nothing is cached" ) {
+
+        CHECK_THROWS( library.continuousEnergyTable( "1001.80c" ) );
+        CHECK( 0 == library.size() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a table is requested as a different type" ) {
+
+      library.continuousEnergyTable( "2003.710nc" );
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( library.photoatomicTable( "2003.710nc" ) );
+        CHECK_THROWS( library.thermalScatteringTable( "2003.710nc" ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a table cannot be loaded as the requested type" ) {
+
+      THEN( "an exception is thrown and nothing is cached" ) {
+
+        CHECK_THROWS( library.continuousEnergyTable( "1000.01p" ) );
+        CHECK( 0 == library.size() );
+        CHECK( "1000.01p" == library.photoatomicTable( "1000.01p" )->ZAID() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+Xsdir xsdir() {
+
+  std::vector< XsdirEntry > entries;
+  for ( std::string name : { "2003.710nc", "1000.01p", "3000.03p" } ) {
+
+    auto summary = peekHeader( name );
+    entries.emplace_back( summary.ZAID(), summary.AWR(), name, 1,
+                          summary.length() );
+  }
+  return Xsdir( {}, std::move( entries ) );
+}
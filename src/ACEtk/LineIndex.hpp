@@ -0,0 +1,74 @@
+#ifndef NJOY_ACETK_LINEINDEX
+#define NJOY_ACETK_LINEINDEX
+
+// system includes
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+// other includes
+#include "tools/Log.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A sparse line offset index for a text buffer
+ *
+ *  The LineIndex class stores the byte offset of every stride-th line in a
+ *  buffer (e.g. a memory mapped ACE file). The offset of an arbitrary line
+ *  is then found by jumping to the closest indexed line that precedes it and
+ *  counting the remaining lines (at most stride - 1 lines) from there. With
+ *  the default stride of 1024 lines, the index for a 3 GB ACE file with 81
+ *  character lines requires less than 300 kB.
+ *
+ *  The size of the buffer is stored with the index so that an index can be
+ *  checked against the buffer it is used on.
+ */
+class LineIndex {
+
+  /* fields */
+  std::size_t stride_ = 1024;
+  std::size_t size_ = 0;
+  std::size_t lines_ = 0;
+  std::vector< std::size_t > offsets_;
+
+public:
+
+  /* constructor */
+  #include "ACEtk/LineIndex/src/ctor.hpp"
+
+  /**
+   *  @brief Return the number of lines between two indexed lines
+   */
+  std::size_t stride() const { return this->stride_; }
+
+  /**
+   *  @brief Return the size of the indexed buffer (in bytes)
+   */
+  std::size_t size() const { return this->size_; }
+
+  /**
+   *  @brief Return the number of lines in the indexed buffer
+   *
+   *  A last line without a terminating newline character is counted as a
+   *  line.
+   */
+  std::size_t numberLines() const { return this->lines_; }
+
+  /**
+   *  @brief Return the byte offsets of the indexed lines
+   *
+   *  The offset of line 1 + i * stride() is given by offsets()[i].
+   */
+  const std::vector< std::size_t >& offsets() const { return this->offsets_; }
+
+  #include "ACEtk/LineIndex/src/offset.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
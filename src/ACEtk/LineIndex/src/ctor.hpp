@@ -0,0 +1,45 @@
+LineIndex() = default;
+LineIndex( const LineIndex& ) = default;
+LineIndex( LineIndex&& ) = default;
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] stride    the number of lines between two indexed lines
+ *  @param[in] size      the size of the indexed buffer (in bytes)
+ *  @param[in] lines     the number of lines in the indexed buffer
+ *  @param[in] offsets   the byte offsets of the indexed lines
+ */
+LineIndex( std::size_t stride, std::size_t size, std::size_t lines,
+           std::vector< std::size_t > offsets ) :
+  stride_( std::max< std::size_t >( 1, stride ) ), size_( size ),
+  lines_( lines ), offsets_( std::move( offsets ) ) {}
+
+/**
+ *  @brief Constructor (from a buffer)
+ *
+ *  @param[in] begin    a pointer to the first character of the buffer
+ *  @param[in] end      a pointer past the last character of the buffer
+ *  @param[in] stride   the number of lines between two indexed lines
+ *                      (default: 1024)
+ */
+LineIndex( const char* begin, const char* end, std::size_t stride = 1024 ) :
+  stride_( std::max< std::size_t >( 1, stride ) ),
+  size_( static_cast< std::size_t >( end - begin ) ) {
+
+  const char* position = begin;
+  while ( position != end ) {
+
+    if ( this->lines_ % this->stride_ == 0 ) {
+
+      this->offsets_.push_back( static_cast< std::size_t >( position - begin ) );
+    }
+    ++this->lines_;
+
+    const void* newline = std::memchr( position, '\n', end - position );
+    position = newline ? static_cast< const char* >( newline ) + 1 : end;
+  }
+}
+
+LineIndex& operator=( const LineIndex& ) = default;
+LineIndex& operator=( LineIndex&& ) = default;
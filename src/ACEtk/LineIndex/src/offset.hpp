@@ -0,0 +1,28 @@
+/**
+ *  @brief Return the byte offset of a line in the indexed buffer
+ *
+ *  @param[in] begin   a pointer to the first character of the indexed buffer
+ *  @param[in] line    the line number (one-based)
+ */
+std::size_t offset( const char* begin, std::size_t line ) const {
+
+  if ( ( line < 1 ) || ( line > this->numberLines() ) ) {
+
+    Log::error( "The requested line number is not in the indexed buffer" );
+    Log::info( "Requested line: {}", line );
+    Log::info( "Number of lines: {}", this->numberLines() );
+    throw std::exception();
+  }
+
+  const std::size_t index = ( line - 1 ) / this->stride();
+  const char* position = begin + this->offsets_[ index ];
+  const char* end = begin + this->size();
+  for ( std::size_t remaining = ( line - 1 ) % this->stride();
+        remaining > 0; --remaining ) {
+
+    position = static_cast< const char* >(
+                   std::memchr( position, '\n', end - position ) ) + 1;
+  }
+
+  return static_cast< std::size_t >( position - begin );
+}
@@ -0,0 +1,98 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ACEtk/LineIndex.hpp"
+
+// other includes
+#include <string>
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+SCENARIO( "LineIndex" ) {
+
+  GIVEN( "a buffer with lines" ) {
+
+    std::string buffer = "line 1\nline 2\n\nline 4 is longer\nline 5\nline 6";
+
+    WHEN( "the buffer is indexed with a stride of 1" ) {
+
+      LineIndex index( buffer.data(), buffer.data() + buffer.size(), 1 );
+
+      THEN( "the offsets of all lines are stored" ) {
+
+        CHECK( 1 == index.stride() );
+        CHECK( buffer.size() == index.size() );
+        CHECK( 6 == index.numberLines() );
+        CHECK( std::vector< std::size_t >{ 0, 7, 14, 15, 32, 39 } == index.offsets() );
+
+        CHECK( 0 == index.offset( buffer.data(), 1 ) );
+        CHECK( 14 == index.offset( buffer.data(), 3 ) );
+        CHECK( 39 == index.offset( buffer.data(), 6 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the buffer is indexed with a stride of 4" ) {
+
+      LineIndex index( buffer.data(), buffer.data() + buffer.size(), 4 );
+
+      THEN( "only some offsets are stored but all lines can be found" ) {
+
+        CHECK( 4 == index.stride() );
+        CHECK( 6 == index.numberLines() );
+        CHECK( std::vector< std::size_t >{ 0, 32 } == index.offsets() );
+
+        CHECK( 0 == index.offset( buffer.data(), 1 ) );
+        CHECK( 7 == index.offset( buffer.data(), 2 ) );
+        CHECK( 14 == index.offset( buffer.data(), 3 ) );
+        CHECK( 15 == index.offset( buffer.data(), 4 ) );
+        CHECK( 32 == index.offset( buffer.data(), 5 ) );
+        CHECK( 39 == index.offset( buffer.data(), 6 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the index is constructed from its data" ) {
+
+      LineIndex index( 4, buffer.size(), 6, { 0, 32 } );
+
+      THEN( "all lines can be found" ) {
+
+        CHECK( 4 == index.stride() );
+        CHECK( buffer.size() == index.size() );
+        CHECK( 6 == index.numberLines() );
+        CHECK( 15 == index.offset( buffer.data(), 4 ) );
+        CHECK( 39 == index.offset( buffer.data(), 6 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an empty buffer" ) {
+
+    std::string buffer;
+    LineIndex index( buffer.data(), buffer.data() );
+
+    THEN( "there are no lines" ) {
+
+      CHECK( 0 == index.size() );
+      CHECK( 0 == index.numberLines() );
+      CHECK( 0 == index.offsets().size() );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    std::string buffer = "line 1\nline 2\n";
+    LineIndex index( buffer.data(), buffer.data() + buffer.size() );
+
+    WHEN( "a line number outside of the buffer is requested" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK( 2 == index.numberLines() );
+        CHECK_THROWS( index.offset( buffer.data(), 0 ) );
+        CHECK_THROWS( index.offset( buffer.data(), 3 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
@@ -0,0 +1,92 @@
+#ifndef NJOY_ACETK_MAPPEDFILE
+#define NJOY_ACETK_MAPPEDFILE
+
+// system includes
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// other includes
+#include "tools/Log.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A read-only memory mapped file
+ *
+ *  The MappedFile class maps the content of a file into memory so that it can
+ *  be parsed directly without first copying it into a string. The mapping is
+ *  released when the object goes out of scope.
+ *
+ *  Pages that have already been parsed can be given back to the operating
+ *  system using the release() function. The data remains accessible (it will
+ *  simply be read again from the file when required).
+ *
+ *  The expected access pattern can be given when the file is mapped. Only
+ *  files that are parsed from front to back should be mapped for sequential
+ *  access, random access and peeking should use the normal access pattern.
+ */
+class MappedFile {
+
+public:
+
+  /**
+   *  @brief The expected access pattern for the mapped file
+   */
+  enum class Access { Normal, Sequential };
+
+private:
+
+  /* fields */
+  std::string filename_;
+  const char* data_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t released_ = 0;
+
+  /* auxiliary functions */
+  #include "ACEtk/MappedFile/src/map.hpp"
+  #include "ACEtk/MappedFile/src/unmap.hpp"
+
+public:
+
+  /* constructor */
+  #include "ACEtk/MappedFile/src/ctor.hpp"
+
+  /**
+   *  @brief Return the file name
+   */
+  const std::string& filename() const { return this->filename_; }
+
+  /**
+   *  @brief Return the size of the file (in bytes)
+   */
+  std::size_t size() const { return this->size_; }
+
+  /**
+   *  @brief Return whether or not the file is empty
+   */
+  bool empty() const { return this->size_ == 0; }
+
+  /**
+   *  @brief Return a pointer to the first character of the file
+   */
+  const char* begin() const { return this->data_; }
+
+  /**
+   *  @brief Return a pointer past the last character of the file
+   */
+  const char* end() const { return this->data_ + this->size_; }
+
+  #include "ACEtk/MappedFile/src/release.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,35 @@
+MappedFile( const MappedFile& ) = delete;
+MappedFile& operator=( const MappedFile& ) = delete;
+
+MappedFile( MappedFile&& file ) :
+  filename_( std::move( file.filename_ ) ),
+  data_( std::exchange( file.data_, nullptr ) ),
+  size_( std::exchange( file.size_, 0 ) ),
+  released_( std::exchange( file.released_, 0 ) ) {}
+
+MappedFile& operator=( MappedFile&& file ) {
+
+  if ( this != &file ) {
+
+    this->unmap();
+    this->filename_ = std::move( file.filename_ );
+    this->data_ = std::exchange( file.data_, nullptr );
+    this->size_ = std::exchange( file.size_, 0 );
+    this->released_ = std::exchange( file.released_, 0 );
+  }
+  return *this;
+}
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] filename   the file name
+ *  @param[in] access     the expected access pattern (default: normal)
+ */
+MappedFile( const std::string& filename, Access access = Access::Normal ) :
+  filename_( filename ) {
+
+  this->map( access );
+}
+
+~MappedFile() { this->unmap(); }
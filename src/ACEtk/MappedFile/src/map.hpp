@@ -0,0 +1,42 @@
+void map( Access access ) {
+
+  int descriptor = ::open( this->filename_.c_str(), O_RDONLY );
+  if ( descriptor == -1 ) {
+
+    Log::error( "Could not open file \'{}\'", this->filename_ );
+    throw std::exception();
+  }
+
+  struct stat status;
+  if ( ::fstat( descriptor, &status ) == -1 ) {
+
+    ::close( descriptor );
+    Log::error( "Could not determine the size of file \'{}\'", this->filename_ );
+    throw std::exception();
+  }
+
+  this->size_ = static_cast< std::size_t >( status.st_size );
+  if ( this->size_ > 0 ) {
+
+    void* address = ::mmap( nullptr, this->size_, PROT_READ, MAP_PRIVATE,
+                            descriptor, 0 );
+    if ( address == MAP_FAILED ) {
+
+      ::close( descriptor );
+      this->size_ = 0;
+      Log::error( "Could not map file \'{}\' into memory", this->filename_ );
+      throw std::exception();
+    }
+    this->data_ = static_cast< const char* >( address );
+
+    // only a file that is read front to back benefits from aggressive
+    // read-ahead (and from dropping pages behind the read position)
+    if ( access == Access::Sequential ) {
+
+      ::madvise( address, this->size_, MADV_SEQUENTIAL );
+    }
+  }
+
+  // the mapping remains valid after the file descriptor is closed
+  ::close( descriptor );
+}
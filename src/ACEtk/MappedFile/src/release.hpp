@@ -0,0 +1,26 @@
+/**
+ *  @brief Release the pages of the file preceding the given position
+ *
+ *  Only whole pages that lie completely before the given position are
+ *  released. Released pages remain accessible but their content will have
+ *  to be read from the file again when they are accessed.
+ *
+ *  @param[in] position   a pointer into the mapped file
+ */
+void release( const char* position ) {
+
+  if ( this->data_ == nullptr ) {
+
+    return;
+  }
+
+  const std::size_t page = static_cast< std::size_t >( ::sysconf( _SC_PAGESIZE ) );
+  const std::size_t offset = static_cast< std::size_t >( position - this->data_ );
+  const std::size_t boundary = ( offset / page ) * page;
+  if ( boundary > this->released_ ) {
+
+    ::madvise( const_cast< char* >( this->data_ + this->released_ ),
+               boundary - this->released_, MADV_DONTNEED );
+    this->released_ = boundary;
+  }
+}
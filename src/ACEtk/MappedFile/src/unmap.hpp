@@ -0,0 +1,10 @@
+void unmap() {
+
+  if ( this->data_ != nullptr ) {
+
+    ::munmap( const_cast< char* >( this->data_ ), this->size_ );
+    this->data_ = nullptr;
+    this->size_ = 0;
+    this->released_ = 0;
+  }
+}
@@ -0,0 +1,290 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/MappedFile.hpp"
+#include "ACEtk/fromMappedFile.hpp"
+#include "ACEtk/peekHeader.hpp"
+
+// other includes
+#include <fstream>
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+std::string chunk();
+std::string chunkWith201Header();
+std::string chunkWithCRLF();
+void writeFile( const std::string&, const std::string& );
+void verifyChunk( const Table& );
+
+SCENARIO( "MappedFile" ) {
+
+  GIVEN( "an existing file" ) {
+
+    std::string string = chunk() + chunkWith201Header();
+    writeFile( "concatenated.ace", string );
+
+    WHEN( "the file is mapped" ) {
+
+      MappedFile file( "concatenated.ace" );
+
+      THEN( "the content is available" ) {
+
+        CHECK( "concatenated.ace" == file.filename() );
+        CHECK( false == file.empty() );
+        CHECK( string.size() == file.size() );
+        CHECK( string == std::string( file.begin(), file.end() ) );
+      } // THEN
+
+      THEN( "pages can be released and the content remains available" ) {
+
+        file.release( file.end() );
+        CHECK( string == std::string( file.begin(), file.end() ) );
+      } // THEN
+
+      THEN( "the mapping can be moved" ) {
+
+        MappedFile moved( std::move( file ) );
+        CHECK( string.size() == moved.size() );
+        CHECK( string == std::string( moved.begin(), moved.end() ) );
+        CHECK( true == file.empty() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the file is mapped for sequential access" ) {
+
+      MappedFile file( "concatenated.ace", MappedFile::Access::Sequential );
+
+      THEN( "the content is available" ) {
+
+        CHECK( string.size() == file.size() );
+        CHECK( string == std::string( file.begin(), file.end() ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the first table is read from the mapped file" ) {
+
+      Table table = fromMappedFile( "concatenated.ace" );
+      Table threaded = fromMappedFile( "concatenated.ace", 2 );
+
+      THEN( "the table is read correctly" ) {
+
+        CHECK( true == std::holds_alternative< Table::Header >( table.header() ) );
+        verifyChunk( table );
+        CHECK( true == std::holds_alternative< Table::Header >( threaded.header() ) );
+        verifyChunk( threaded );
+      } // THEN
+    } // WHEN
+
+    WHEN( "all tables are read from the mapped file" ) {
+
+      std::vector< Table > tables = fromMappedConcatenatedFile( "concatenated.ace" );
+
+      THEN( "the tables are read correctly" ) {
+
+        CHECK( 2 == tables.size() );
+        CHECK( true == std::holds_alternative< Table::Header >( tables[0].header() ) );
+        CHECK( true == std::holds_alternative< Table::Header201 >( tables[1].header() ) );
+        verifyChunk( tables[0] );
+        verifyChunk( tables[1] );
+      } // THEN
+    } // WHEN
+
+    WHEN( "all tables are read from the mapped file using multiple threads" ) {
+
+      std::vector< Table > tables = fromMappedConcatenatedFile( "concatenated.ace", 2 );
+
+      THEN( "the tables are read correctly and in order" ) {
+
+        CHECK( 2 == tables.size() );
+        CHECK( true == std::holds_alternative< Table::Header >( tables[0].header() ) );
+        CHECK( true == std::holds_alternative< Table::Header201 >( tables[1].header() ) );
+        verifyChunk( tables[0] );
+        verifyChunk( tables[1] );
+      } // THEN
+    } // WHEN
+
+    WHEN( "all tables are read from the file using multiple threads" ) {
+
+      std::vector< Table > tables = fromConcatenatedFile( "concatenated.ace", 2 );
+
+      THEN( "the tables are read correctly and in order" ) {
+
+        CHECK( 2 == tables.size() );
+        CHECK( true == std::holds_alternative< Table::Header >( tables[0].header() ) );
+        CHECK( true == std::holds_alternative< Table::Header201 >( tables[1].header() ) );
+        verifyChunk( tables[0] );
+        verifyChunk( tables[1] );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a file with CRLF line endings" ) {
+
+    writeFile( "crlf.ace", chunkWithCRLF() + chunkWithCRLF() );
+
+    WHEN( "the tables are read or peeked at" ) {
+
+      std::vector< Table > sequential = fromConcatenatedFile( "crlf.ace" );
+      std::vector< Table > threaded = fromConcatenatedFile( "crlf.ace", 2 );
+      std::vector< Table > mapped = fromMappedConcatenatedFile( "crlf.ace", 2 );
+      auto summaries = peekConcatenatedFile( "crlf.ace" );
+
+      THEN( "all tables are found" ) {
+
+        CHECK( 2 == sequential.size() );
+        CHECK( 2 == threaded.size() );
+        CHECK( 2 == mapped.size() );
+        CHECK( 2 == summaries.size() );
+        CHECK( 1 == summaries[0].lineNumber() );
+        CHECK( 95 == summaries[1].lineNumber() );
+        for ( const auto& table : threaded ) {
+
+          CHECK( 328 == table.data().XSS().size() );
+          CHECK_THAT( 1.09375, WithinRel( table.data().XSS( 328 ) ) );
+        }
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an empty file" ) {
+
+    writeFile( "empty.ace", "" );
+
+    WHEN( "the file is mapped" ) {
+
+      MappedFile file( "empty.ace" );
+
+      THEN( "the mapping is empty" ) {
+
+        CHECK( true == file.empty() );
+        CHECK( 0 == file.size() );
+        CHECK( file.begin() == file.end() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "tables are read from the mapped file" ) {
+
+      std::vector< Table > tables = fromMappedConcatenatedFile( "empty.ace" );
+      std::vector< Table > threaded = fromMappedConcatenatedFile( "empty.ace", 4 );
+
+      THEN( "no tables are found" ) {
+
+        CHECK( 0 == tables.size() );
+        CHECK( 0 == threaded.size() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    WHEN( "the file does not exist" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( MappedFile( "not-a-file.ace" ) );
+        CHECK_THROWS( fromMappedFile( "not-a-file.ace" ) );
+        CHECK_THROWS( fromMappedConcatenatedFile( "not-a-file.ace" ) );
+        CHECK_THROWS( fromMappedConcatenatedFile( "not-a-file.ace", 2 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+void writeFile( const std::string& filename, const std::string& content ) {
+
+  std::ofstream out( filename, std::ios::binary );
+  out << content;
+}
+
+std::string chunk() {
+
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWith201Header() {
+
+  return
+    "2.0.1                   92238.800nc            ENDF/B-VIII.0\n"
+    "  236.005800   2.5301E-08 2018-05-01          2\n"
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWithCRLF() {
+
+  // 82 full XSS lines of 82 characters each
+  std::string string =
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "      328    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n";
+  for ( unsigned int i = 0; i < 82; ++i ) {
+
+    string += "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n";
+  }
+
+  std::string crlf;
+  for ( char c : string ) {
+
+    if ( c == '\n' ) {
+
+      crlf += '\r';
+    }
+    crlf += c;
+  }
+  return crlf;
+}
+
+void verifyChunk( const Table& chunk ) {
+
+  CHECK( 6 == chunk.data().NXS(1) );
+  CHECK( 33074 == chunk.data().NXS(2) );
+  CHECK( 1 == chunk.data().JXS(1) );
+  CHECK( 8 == chunk.data().JXS(32) );
+
+  CHECK( 6 == chunk.data().XSS().size() );
+  CHECK_THAT( 1.00000000000E+00, WithinRel( chunk.data().XSS(1) ) );
+  CHECK_THAT( 1.03125000000E+00, WithinRel( chunk.data().XSS(2) ) );
+  CHECK_THAT( 1.06250000000E+00, WithinRel( chunk.data().XSS(3) ) );
+  CHECK_THAT( 1.09375000000E+00, WithinRel( chunk.data().XSS(4) ) );
+  CHECK_THAT( 1.12500000000E+00, WithinRel( chunk.data().XSS(5) ) );
+  CHECK_THAT( 1.15625000000E+00, WithinRel( chunk.data().XSS(6) ) );
+}
@@ -0,0 +1,133 @@
+#ifndef NJOY_ACETK_MATERIAL
+#define NJOY_ACETK_MATERIAL
+
+// system includes
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/EnergyGridScheme.hpp"
+#include "ACEtk/ContinuousEnergyTable.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A material made up of nuclides with their atom densities
+ *
+ *  The energy grids of the ESZ blocks of all nuclides are merged into a
+ *  single unionized energy grid. The macroscopic total, absorption and
+ *  elastic cross sections of the material are precomputed on that grid, so
+ *  that a macroscopic lookup requires a single search on the unionized grid
+ *  instead of one search per nuclide. The absorption cross section is the
+ *  disappearance cross section of the ESZ block.
+ *
+ *  Discontinuities on the energy grid of a nuclide are retained on the
+ *  unionized grid, so that the macroscopic cross sections are exact for
+ *  linear interpolation.
+ *
+ *  The location of an energy value on the energy grid of each nuclide can
+ *  be derived from its location on the unionized grid. With the unionized
+ *  scheme, an index map storing the interval of each nuclide for each point
+ *  of the unionized grid is used. With the hashed scheme, the index map is
+ *  replaced by a lethargy hash of the energy grid of each nuclide (see
+ *  continuous::ESZ::EnergyGridIndex) which requires far less memory at the
+ *  cost of a short search.
+ *
+ *  The material shares ownership of the tables of its nuclides (e.g. the
+ *  tables handed out by a Library), so that the energy grids it refers to
+ *  remain valid for as long as the material exists.
+ */
+class Material {
+
+public:
+
+  using EnergyGridIndex = continuous::ESZ::EnergyGridIndex;
+  using Location = EnergyGridIndex::Location;
+
+private:
+
+  /* fields */
+  std::vector< std::shared_ptr< const ContinuousEnergyTable > > nuclides_;
+  std::vector< double > densities_;
+  EnergyGridScheme scheme_;
+  std::vector< double > energies_;
+  EnergyGridIndex index_;
+  std::vector< double > total_;
+  std::vector< double > absorption_;
+  std::vector< double > elastic_;
+  std::vector< std::uint32_t > map_;
+  std::vector< EnergyGridIndex > hashes_;
+
+  /* auxiliary functions */
+  #include "ACEtk/Material/src/unionize.hpp"
+  #include "ACEtk/Material/src/accumulate.hpp"
+
+public:
+
+  /* constructor */
+  #include "ACEtk/Material/src/ctor.hpp"
+
+  /**
+   *  @brief Return the number of nuclides in the material
+   */
+  std::size_t numberNuclides() const { return this->nuclides_.size(); }
+
+  /**
+   *  @brief Return the table of a nuclide
+   *
+   *  @param[in] nuclide   the nuclide index (zero-based)
+   */
+  const ContinuousEnergyTable& nuclide( std::size_t nuclide ) const {
+
+    return *this->nuclides_[ nuclide ];
+  }
+
+  /**
+   *  @brief Return the atom densities of the nuclides
+   */
+  const std::vector< double >& densities() const { return this->densities_; }
+
+  /**
+   *  @brief Return the energy grid scheme
+   */
+  EnergyGridScheme scheme() const { return this->scheme_; }
+
+  /**
+   *  @brief Return the number of energy points on the unionized grid
+   */
+  std::size_t numberEnergyPoints() const { return this->energies_.size(); }
+
+  /**
+   *  @brief Return the unionized energy grid
+   */
+  const std::vector< double >& energies() const { return this->energies_; }
+
+  /**
+   *  @brief Return the macroscopic total cross section values
+   */
+  const std::vector< double >& total() const { return this->total_; }
+
+  /**
+   *  @brief Return the macroscopic absorption cross section values
+   */
+  const std::vector< double >& absorption() const { return this->absorption_; }
+
+  /**
+   *  @brief Return the macroscopic elastic cross section values
+   */
+  const std::vector< double >& elastic() const { return this->elastic_; }
+
+  #include "ACEtk/Material/src/locate.hpp"
+  #include "ACEtk/Material/src/evaluate.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ *  @brief Add the contribution of a nuclide to the macroscopic cross sections
+ *
+ *  The nuclide cross sections are evaluated on every point of the unionized
+ *  grid. At a discontinuity, the values on either side of the discontinuity
+ *  are assigned to the corresponding points of the unionized grid. Outside
+ *  of the energy grid of the nuclide, the first or last values are used.
+ *
+ *  @param[in] nuclide   the nuclide index (zero-based)
+ */
+void accumulate( std::size_t nuclide ) {
+
+  const auto& esz = this->nuclides_[ nuclide ]->ESZ();
+  const auto energies = esz.energies();
+  const auto total = esz.total();
+  const auto absorption = esz.disappearance();
+  const auto elastic = esz.elastic();
+  const double density = this->densities_[ nuclide ];
+  const std::size_t size = energies.size();
+  const std::size_t points = this->energies_.size();
+  const std::size_t nuclides = this->nuclides_.size();
+
+  auto add = [&] ( std::size_t point, std::size_t left, double fraction ) {
+
+    auto interpolate = [&] ( const auto& values ) {
+
+      return fraction == 0. ? values[ left ]
+                            : values[ left ] + fraction * ( values[ left + 1 ] -
+                                                            values[ left ] );
+    };
+
+    this->total_[ point ] += density * interpolate( total );
+    this->absorption_[ point ] += density * interpolate( absorption );
+    this->elastic_[ point ] += density * interpolate( elastic );
+    if ( this->scheme_ == EnergyGridScheme::Unionized ) {
+
+      this->map_[ point * nuclides + nuclide ] =
+          static_cast< std::uint32_t >( std::min( left, size - 2 ) );
+    }
+  };
+
+  std::size_t current = 0;
+  for ( std::size_t point = 0; point < points; ) {
+
+    // the number of times the energy appears on both grids
+    const double energy = this->energies_[ point ];
+    std::size_t copies = 1;
+    while ( ( point + copies < points ) &&
+            ( this->energies_[ point + copies ] == energy ) ) {
+
+      ++copies;
+    }
+    while ( ( current < size ) && ( energies[ current ] < energy ) ) {
+
+      ++current;
+    }
+    std::size_t matches = 0;
+    while ( ( current + matches < size ) &&
+            ( energies[ current + matches ] == energy ) ) {
+
+      ++matches;
+    }
+
+    for ( std::size_t copy = 0; copy < copies; ++copy, ++point ) {
+
+      if ( matches > 0 ) {
+
+        add( point, current + std::min( copy, matches - 1 ), 0. );
+      }
+      else if ( current == 0 ) {
+
+        add( point, 0, 0. );
+      }
+      else if ( current == size ) {
+
+        add( point, size - 1, 0. );
+      }
+      else {
+
+        const double lower = energies[ current - 1 ];
+        const double upper = energies[ current ];
+        add( point, current - 1, ( energy - lower ) / ( upper - lower ) );
+      }
+    }
+  }
+}
@@ -0,0 +1,76 @@
+/**
+ *  @brief Copy constructor
+ *
+ *  The lethargy hash of the unionized grid refers to the energy values of
+ *  the material, so it is constructed again for the copied energy values.
+ *
+ *  @param[in] material   the material to be copied
+ */
+Material( const Material& material ) :
+  nuclides_( material.nuclides_ ), densities_( material.densities_ ),
+  scheme_( material.scheme_ ), energies_( material.energies_ ),
+  index_( energies_.begin(), energies_.end(),
+          static_cast< unsigned int >( material.index_.numberBins() ) ),
+  total_( material.total_ ), absorption_( material.absorption_ ),
+  elastic_( material.elastic_ ), map_( material.map_ ),
+  hashes_( material.hashes_ ) {}
+
+Material( Material&& ) = default;
+
+Material& operator=( const Material& material ) {
+
+  if ( this != &material ) {
+
+    *this = Material( material );
+  }
+  return *this;
+}
+
+Material& operator=( Material&& ) = default;
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] nuclides    the tables of the nuclides
+ *  @param[in] densities   the atom densities of the nuclides
+ *  @param[in] scheme      the energy grid scheme (default: unionized)
+ *  @param[in] bins        the number of lethargy bins used for the hashes
+ *                         of the energy grids (default: 8192)
+ */
+Material( std::vector< std::shared_ptr< const ContinuousEnergyTable > > nuclides,
+          std::vector< double > densities,
+          EnergyGridScheme scheme = EnergyGridScheme::Unionized,
+          unsigned int bins = 8192 ) :
+  nuclides_( std::move( nuclides ) ),
+  densities_( std::move( densities ) ), scheme_( scheme ),
+  energies_( unionize( nuclides_ ) ),
+  index_( energies_.begin(), energies_.end(), bins ),
+  total_( energies_.size(), 0. ), absorption_( energies_.size(), 0. ),
+  elastic_( energies_.size(), 0. ) {
+
+  if ( this->nuclides_.size() != this->densities_.size() ) {
+
+    Log::error( "The number of nuclides and atom densities in a material "
+                "must be the same" );
+    Log::info( "Number of nuclides: {}", this->nuclides_.size() );
+    Log::info( "Number of atom densities: {}", this->densities_.size() );
+    throw std::exception();
+  }
+
+  if ( scheme == EnergyGridScheme::Unionized ) {
+
+    this->map_.resize( this->energies_.size() * this->nuclides_.size() );
+  }
+  else {
+
+    for ( const auto& nuclide : this->nuclides_ ) {
+
+      this->hashes_.push_back( nuclide->ESZ().energyGridIndex( bins ) );
+    }
+  }
+
+  for ( std::size_t nuclide = 0; nuclide < this->nuclides_.size(); ++nuclide ) {
+
+    this->accumulate( nuclide );
+  }
+}
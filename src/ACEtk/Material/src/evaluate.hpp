@@ -0,0 +1,53 @@
+/**
+ *  @brief Evaluate the macroscopic cross sections for a batch of energies
+ *
+ *  The macroscopic cross sections are interpolated linearly on the
+ *  unionized grid (lin-lin interpolation), which requires a single lookup
+ *  per energy value regardless of the number of nuclides. Energy values
+ *  outside of the grid are clamped to the first or last energy value.
+ *
+ *  An output array that is a null pointer is not evaluated.
+ *
+ *  @param[in]  energies     the energy values
+ *  @param[in]  size         the number of energy values
+ *  @param[out] total        the macroscopic total cross section values
+ *  @param[out] absorption   the macroscopic absorption cross section values
+ *  @param[out] elastic      the macroscopic elastic cross section values
+ */
+void evaluate( const double* energies, std::size_t size,
+               double* total, double* absorption, double* elastic ) const {
+
+  const double* arrays[3] = { this->total_.data(),
+                              this->absorption_.data(),
+                              this->elastic_.data() };
+  double* results[3] = { total, absorption, elastic };
+
+  constexpr std::size_t chunk = 256;
+  std::size_t indices[ chunk ];
+  double fractions[ chunk ];
+  for ( std::size_t start = 0; start < size; start += chunk ) {
+
+    const std::size_t length = std::min( chunk, size - start );
+    for ( std::size_t i = 0; i < length; ++i ) {
+
+      const auto location = this->locate( energies[ start + i ] );
+      indices[i] = location.index;
+      fractions[i] = location.fraction;
+    }
+
+    for ( unsigned int array = 0; array < 3; ++array ) {
+
+      if ( results[ array ] ) {
+
+        const double* values = arrays[ array ];
+        double* result = results[ array ] + start;
+        for ( std::size_t i = 0; i < length; ++i ) {
+
+          const double left = values[ indices[i] ];
+          const double right = values[ indices[i] + 1 ];
+          result[i] = left + fractions[i] * ( right - left );
+        }
+      }
+    }
+  }
+}
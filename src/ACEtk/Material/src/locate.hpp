@@ -0,0 +1,41 @@
+/**
+ *  @brief Return the location of an energy value on the unionized grid
+ *
+ *  The location is found using the lethargy hash of the unionized grid (see
+ *  continuous::ESZ::EnergyGridIndex::lookup).
+ *
+ *  @param[in] energy   the energy value
+ */
+Location locate( double energy ) const {
+
+  return this->index_.lookup( energy );
+}
+
+/**
+ *  @brief Return the location of an energy value on the grid of a nuclide
+ *
+ *  With the unionized scheme, the interval is taken from the index map
+ *  without any search. With the hashed scheme, the lethargy hash of the
+ *  nuclide is used. The location is the same as the one given by
+ *  continuous::ESZ::locate for the nuclide.
+ *
+ *  @param[in] nuclide    the nuclide index (zero-based)
+ *  @param[in] energy     the energy value
+ *  @param[in] location   the location of the energy on the unionized grid
+ */
+Location locate( std::size_t nuclide, double energy,
+                 const Location& location ) const {
+
+  if ( this->scheme_ == EnergyGridScheme::Hashed ) {
+
+    return this->hashes_[ nuclide ].lookup( energy );
+  }
+
+  const auto energies = this->nuclides_[ nuclide ]->ESZ().energies();
+  const std::size_t index =
+      this->map_[ location.index * this->nuclides_.size() + nuclide ];
+  const double lower = energies[ index ];
+  const double upper = energies[ index + 1 ];
+  const double fraction = ( energy - lower ) / ( upper - lower );
+  return { index, std::clamp( fraction, 0., 1. ) };
+}
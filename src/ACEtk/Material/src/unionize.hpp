@@ -0,0 +1,53 @@
+/**
+ *  @brief Merge the energy grids of a range of nuclides
+ *
+ *  The grids are merged pairwise in a balanced way. An energy value that
+ *  appears several times on a grid (a discontinuity) appears as many times
+ *  on the merged grid as on the grid where it appears the most.
+ *
+ *  @param[in] first   the iterator to the first nuclide
+ *  @param[in] last    the iterator past the last nuclide
+ */
+template< typename Iterator >
+static std::vector< double > unionize( Iterator first, Iterator last ) {
+
+  const auto size = std::distance( first, last );
+  if ( size == 1 ) {
+
+    const auto energies = ( *first )->ESZ().energies();
+    return std::vector< double >( energies.begin(), energies.end() );
+  }
+
+  const auto middle = std::next( first, size / 2 );
+  const auto left = unionize( first, middle );
+  const auto right = unionize( middle, last );
+
+  std::vector< double > energies;
+  energies.reserve( left.size() + right.size() );
+  std::set_union( left.begin(), left.end(), right.begin(), right.end(),
+                  std::back_inserter( energies ) );
+  return energies;
+}
+
+/**
+ *  @brief Merge the energy grids of the nuclides
+ *
+ *  @param[in] nuclides   the nuclides
+ */
+static std::vector< double >
+unionize( const std::vector< std::shared_ptr< const ContinuousEnergyTable > >& nuclides ) {
+
+  if ( nuclides.empty() ) {
+
+    Log::error( "A material requires at least one nuclide" );
+    throw std::exception();
+  }
+
+  if ( std::find( nuclides.begin(), nuclides.end(), nullptr ) != nuclides.end() ) {
+
+    Log::error( "The table of a nuclide in a material cannot be a null pointer" );
+    throw std::exception();
+  }
+
+  return unionize( nuclides.begin(), nuclides.end() );
+}
@@ -0,0 +1,234 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+using Catch::Matchers::WithinAbs;
+
+// what we are testing
+#include "ACEtk/Material.hpp"
+
+// other includes
+#include <memory>
+#include "ACEtk/fromFile.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+ContinuousEnergyTable makeNuclide( const ContinuousEnergyTable& );
+void verifyMaterial( const Material&, const ContinuousEnergyTable&,
+                     const ContinuousEnergyTable& );
+
+SCENARIO( "Material" ) {
+
+  GIVEN( "two nuclides with different energy grids" ) {
+
+    auto he3 = std::make_shared< const ContinuousEnergyTable >( fromFile( "2003.710nc" ) );
+    auto other = std::make_shared< const ContinuousEnergyTable >( makeNuclide( *he3 ) );
+
+    WHEN( "a material is constructed using the unionized scheme" ) {
+
+      Material material( { he3, other }, { 2., 0.5 } );
+
+      THEN( "the material can be tested" ) {
+
+        CHECK( EnergyGridScheme::Unionized == material.scheme() );
+        verifyMaterial( material, *he3, *other );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a material is constructed using the hashed scheme" ) {
+
+      Material material( { he3, other }, { 2., 0.5 }, EnergyGridScheme::Hashed );
+
+      THEN( "the material can be tested" ) {
+
+        CHECK( EnergyGridScheme::Hashed == material.scheme() );
+        verifyMaterial( material, *he3, *other );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a material is moved" ) {
+
+      Material material( { he3, other }, { 2., 0.5 } );
+      Material moved( std::move( material ) );
+
+      THEN( "the material can be tested" ) {
+
+        verifyMaterial( moved, *he3, *other );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a material is copied and the original is destroyed" ) {
+
+      auto material = std::make_unique< Material >(
+                          std::vector< std::shared_ptr< const ContinuousEnergyTable > >{ he3, other },
+                          std::vector< double >{ 2., 0.5 } );
+      Material copy( *material );
+      material.reset();
+
+      THEN( "the material can be tested" ) {
+
+        verifyMaterial( copy, *he3, *other );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a material is copy assigned and the original is destroyed" ) {
+
+      auto material = std::make_unique< Material >(
+                          std::vector< std::shared_ptr< const ContinuousEnergyTable > >{ he3, other },
+                          std::vector< double >{ 2., 0.5 },
+                          EnergyGridScheme::Hashed );
+      Material copy( { other }, { 1. } );
+      copy = *material;
+      material.reset();
+
+      THEN( "the material can be tested" ) {
+
+        CHECK( EnergyGridScheme::Hashed == copy.scheme() );
+        verifyMaterial( copy, *he3, *other );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the material is the only owner of the tables" ) {
+
+      Material material( { he3, other }, { 2., 0.5 } );
+      const auto* address = he3.get();
+      const auto points = he3->ESZ().NES();
+      he3.reset();
+      other.reset();
+
+      THEN( "the tables remain available" ) {
+
+        CHECK( address == &material.nuclide( 0 ) );
+        CHECK( points == material.nuclide( 0 ).ESZ().NES() );
+        CHECK( 4 == material.nuclide( 1 ).ESZ().NES() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    auto he3 = std::make_shared< const ContinuousEnergyTable >( fromFile( "2003.710nc" ) );
+
+    WHEN( "there are no nuclides" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( Material( {}, {} ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the number of nuclides and densities are not the same" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( Material( { he3 }, { 1., 2. } ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the table of a nuclide is a null pointer" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( Material( { he3, nullptr }, { 1., 2. } ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+ContinuousEnergyTable makeNuclide( const ContinuousEnergyTable& base ) {
+
+  // a grid with a discontinuity at 1 MeV, on top of a point of the He3 grid
+  continuous::ESZ esz( { 1e-6, 1., 1., 30. },
+                       { 2., 3., 5., 7. },
+                       { 1., 1., 1., 1. },
+                       { 1., 2., 4., 6. },
+                       { 0., 0., 0., 0. } );
+
+  return ContinuousEnergyTable( 1, 1, 0, base.header(),
+                                std::move( esz ), base.NU(), base.DNU(),
+                                base.MTR(), base.LQR(),
+                                base.SIG(), base.AND(), base.DLW(),
+                                base.BDD(), base.DNED(),
+                                base.GPD(), base.MTRP(), base.SIGP(),
+                                base.ANDP(), base.DLWP(), base.YP(),
+                                base.UNR(),
+                                std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt );
+}
+
+void verifyMaterial( const Material& material,
+                     const ContinuousEnergyTable& first,
+                     const ContinuousEnergyTable& second ) {
+
+  CHECK( 2 == material.numberNuclides() );
+  CHECK( &first == &material.nuclide( 0 ) );
+  CHECK( &second == &material.nuclide( 1 ) );
+  CHECK( 2 == material.densities().size() );
+
+  const auto& energies = material.energies();
+  CHECK( true == std::is_sorted( energies.begin(), energies.end() ) );
+  CHECK( material.numberEnergyPoints() == energies.size() );
+  CHECK( material.numberEnergyPoints() == material.total().size() );
+  CHECK( material.numberEnergyPoints() == material.absorption().size() );
+  CHECK( material.numberEnergyPoints() == material.elastic().size() );
+
+  // all points of both grids are on the unionized grid
+  for ( const auto& nuclide : { &first, &second } ) {
+
+    for ( double energy : nuclide->ESZ().energies() ) {
+
+      CHECK( true == std::binary_search( energies.begin(), energies.end(), energy ) );
+    }
+  }
+
+  // the discontinuity of the second nuclide is retained
+  auto range = std::equal_range( energies.begin(), energies.end(), 1. );
+  CHECK( 2 == std::distance( range.first, range.second ) );
+  CHECK( 30. == energies.back() );
+
+  // macroscopic cross sections for a range of energies
+  std::vector< double > values;
+  for ( double energy = 1e-12; energy < 40.; energy *= 1.07 ) {
+
+    values.push_back( energy );
+  }
+  values.push_back( 1. );
+  values.push_back( 20. );
+
+  const std::size_t size = values.size();
+  std::vector< double > total( size ), absorption( size ), elastic( size );
+  std::vector< double > t1( size ), a1( size ), e1( size );
+  std::vector< double > t2( size ), a2( size ), e2( size );
+  material.evaluate( values.data(), size, total.data(), absorption.data(),
+                     elastic.data() );
+  first.evaluate( values.data(), size, t1.data(), e1.data(), a1.data(), nullptr );
+  second.evaluate( values.data(), size, t2.data(), e2.data(), a2.data(), nullptr );
+
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    CHECK_THAT( total[i], WithinRel( 2. * t1[i] + 0.5 * t2[i], 1e-10 ) );
+    CHECK_THAT( absorption[i], WithinRel( 2. * a1[i] + 0.5 * a2[i], 1e-10 ) );
+    CHECK_THAT( elastic[i], WithinRel( 2. * e1[i] + 0.5 * e2[i], 1e-10 ) );
+  }
+
+  // at the discontinuity, the values above the discontinuity are used
+  material.evaluate( values.data() + size - 2, 1, total.data(), nullptr, nullptr );
+  CHECK_THAT( total[0], WithinRel( 2. * t1[ size - 2 ] + 0.5 * 5., 1e-10 ) );
+
+  // the location on the grid of each nuclide
+  for ( double energy : values ) {
+
+    const auto location = material.locate( energy );
+    const auto l1 = material.locate( 0, energy, location );
+    const auto l2 = material.locate( 1, energy, location );
+    const auto r1 = first.ESZ().locate( energy );
+    const auto r2 = second.ESZ().locate( energy );
+
+    CHECK( r1.index == l1.index );
+    CHECK_THAT( r1.fraction, WithinAbs( l1.fraction, 1e-12 ) );
+    CHECK( r2.index == l2.index );
+    CHECK_THAT( r2.fraction, WithinAbs( l2.fraction, 1e-12 ) );
+  }
+}
@@ -0,0 +1,20 @@
+#ifndef NJOY_ACETK_MATRIXLAYOUT
+#define NJOY_ACETK_MATRIXLAYOUT
+
+// system includes
+
+// other includes
+
+namespace njoy {
+namespace ACEtk {
+
+  enum class MatrixLayout : short {
+
+    RowMajor,    // the values of a row are contiguous
+    ColumnMajor  // the values of a column are contiguous
+  };
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
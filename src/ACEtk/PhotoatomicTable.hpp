@@ -5,6 +5,7 @@
 
 // other includes
 #include "ACEtk/Table.hpp"
+#include "ACEtk/BlockSelection.hpp"
 #include "ACEtk/photoatomic/PrincipalCrossSectionBlock.hpp"
 #include "ACEtk/photoatomic/IncoherentScatteringFunctionBlock.hpp"
 #include "ACEtk/photoatomic/CoherentFormFactorBlock.hpp"
@@ -33,7 +34,32 @@ namespace ACEtk {
  */
 class PhotoatomicTable : protected Table {
 
+public:
+
+  /* type aliases */
+
+  /**
+   *  @brief The blocks of the table that can be selected for loading
+   */
+  enum class Block : unsigned int {
+
+    ESZG = 0, JINC, JCOH, JFLO, LHNM, EPS, SWD, SUBSH, SPHEL,
+    XPROB, ESZE, EXCIT, ELAS, EION, BREME, BREML, SELAS
+  };
+  using BlockSelection = ACEtk::BlockSelection< Block >;
+
+  /**
+   *  @brief Combine two blocks into a block selection
+   */
+  friend constexpr BlockSelection operator|( Block left, Block right ) {
+
+    return BlockSelection( left ) | right;
+  }
+
+private:
+
   /* fields */
+  BlockSelection blocks_;
   photoatomic::ESZG eszg_;
   photoatomic::JINC jinc_;
   photoatomic::JCOH jcoh_;
@@ -56,6 +82,7 @@ class PhotoatomicTable : protected Table {
   #include "ACEtk/PhotoatomicTable/src/generateBlocks.hpp"
   #include "ACEtk/PhotoatomicTable/src/generateData.hpp"
   #include "ACEtk/PhotoatomicTable/src/verifyType.hpp"
+  #include "ACEtk/PhotoatomicTable/src/verifyBlock.hpp"
   #include "ACEtk/PhotoatomicTable/src/verifySubshellIndex.hpp"
 
 public:
@@ -63,9 +90,16 @@ public:
   #include "ACEtk/PhotoatomicTable/src/ctor.hpp"
 
   using Table::header;
-  using Table::data;
   using Table::print;
 
+  /**
+   *  @brief Return the data arrays
+   *
+   *  The blocks of the table refer to the XSS array so only const access to
+   *  the data arrays is provided.
+   */
+  const Data& data() const { return Table::data(); }
+
   /**
    *  @brief Return the full ZAID or SZAID of the table
    */
@@ -297,7 +331,11 @@ public:
   /**
    *  @brief Return the principal cross section block
    */
-  const photoatomic::ESZG& ESZG() const { return this->eszg_; }
+  const photoatomic::ESZG& ESZG() const {
+
+    this->verifyBlock( Block::ESZG );
+    return this->eszg_;
+  }
 
   /**
    *  @brief Return the principal cross section block
@@ -310,7 +348,11 @@ public:
   /**
    *  @brief Return the incoherent scattering function block
    */
-  const photoatomic::JINC& JINC() const { return this->jinc_; }
+  const photoatomic::JINC& JINC() const {
+
+    this->verifyBlock( Block::JINC );
+    return this->jinc_;
+  }
 
   /**
    *  @brief Return the incoherent scattering function block
@@ -323,7 +365,11 @@ public:
   /**
    *  @brief Return the coherent form factor block
    */
-  const photoatomic::JCOH& JCOH() const { return this->jcoh_; }
+  const photoatomic::JCOH& JCOH() const {
+
+    this->verifyBlock( Block::JCOH );
+    return this->jcoh_;
+  }
 
   /**
    *  @brief Return the coherent form factor block
@@ -336,7 +382,11 @@ public:
   /**
    *  @brief Return the fluoresence data block
    */
-  const std::optional< photoatomic::JFLO >& JFLO() const { return this->jflo_; }
+  const std::optional< photoatomic::JFLO >& JFLO() const {
+
+    this->verifyBlock( Block::JFLO );
+    return this->jflo_;
+  }
 
   /**
    *  @brief Return the fluoresence data block
@@ -349,7 +399,11 @@ public:
   /**
    *  @brief Return the heating numbers block
    */
-  const photoatomic::LHNM& LHNM() const { return this->lhnm_; }
+  const photoatomic::LHNM& LHNM() const {
+
+    this->verifyBlock( Block::LHNM );
+    return this->lhnm_;
+  }
 
   /**
    *  @brief Return the heating numbers block
@@ -359,7 +413,11 @@ public:
   /**
    *  @brief Return the electron shell block
    */
-  const std::optional< electron::EPS >& EPS() const { return this->eps_; }
+  const std::optional< electron::EPS >& EPS() const {
+
+    this->verifyBlock( Block::EPS );
+    return this->eps_;
+  }
 
   /**
    *  @brief Return the electron shell block
@@ -372,7 +430,11 @@ public:
   /**
    *  @brief Return the compton profile block
    */
-  const std::optional< photoatomic::SWD >& SWD() const { return this->swd_; }
+  const std::optional< photoatomic::SWD >& SWD() const {
+
+    this->verifyBlock( Block::SWD );
+    return this->swd_;
+  }
 
   /**
    *  @brief Return the compton profile block
@@ -385,7 +447,11 @@ public:
   /**
    *  @brief Return the electron subshell data block for eprdata (NEPR > 0)
    */
-  const std::optional< electron::SUBSH >& SUBSH() const { return this->subsh_; }
+  const std::optional< electron::SUBSH >& SUBSH() const {
+
+    this->verifyBlock( Block::SUBSH );
+    return this->subsh_;
+  }
 
   /**
    *  @brief Return the electron subshell data block for eprdata (NEPR > 0)
@@ -400,6 +466,7 @@ public:
    */
   const std::optional< photoatomic::SPHEL >& SPHEL() const {
 
+    this->verifyBlock( Block::SPHEL );
     return this->sphel_;
   }
 
@@ -414,7 +481,11 @@ public:
   /**
    *  @brief Return the subshell transition data block for eprdata (NEPR > 0)
    */
-  const std::optional< electron::XPROB >& XPROB() const { return this->xprob_; }
+  const std::optional< electron::XPROB >& XPROB() const {
+
+    this->verifyBlock( Block::XPROB );
+    return this->xprob_;
+  }
 
   /**
    *  @brief Return the subshell transition data block for eprdata (NEPR > 0)
@@ -427,7 +498,11 @@ public:
   /**
    *  @brief Return the electron cross section block for eprdata (NEPR > 0)
    */
-  const std::optional< electron::ESZE >& ESZE() const { return this->esze_; }
+  const std::optional< electron::ESZE >& ESZE() const {
+
+    this->verifyBlock( Block::ESZE );
+    return this->esze_;
+  }
 
   /**
    *  @brief Return the electron cross section block for eprdata (NEPR > 0)
@@ -440,7 +515,11 @@ public:
   /**
    *  @brief Return the electron excitation energy loss block for eprdata (NEPR > 0)
    */
-  const std::optional< electron::EXCIT >& EXCIT() const { return this->excit_; }
+  const std::optional< electron::EXCIT >& EXCIT() const {
+
+    this->verifyBlock( Block::EXCIT );
+    return this->excit_;
+  }
 
   /**
    *  @brief Return the electron excitation energy loss block for eprdata (NEPR > 0)
@@ -453,7 +532,11 @@ public:
   /**
    *  @brief Return the electron elastic angular distribution block for eprdata (NEPR > 0)
    */
-  const std::optional< electron::ELAS >& ELAS() const { return this->elas_; }
+  const std::optional< electron::ELAS >& ELAS() const {
+
+    this->verifyBlock( Block::ELAS );
+    return this->elas_;
+  }
 
   /**
    *  @brief Return the electron elastic angular distribution block for eprdata (NEPR > 0)
@@ -477,6 +560,7 @@ public:
     #ifndef NDEBUG
     this->verifySubshellIndex( index );
     #endif
+    this->verifyBlock( Block::EION );
     return this->eion_[ index - 1 ];
   }
 
@@ -497,7 +581,11 @@ public:
   /**
    *  @brief Return the Bremsstrahlung energy distribution block for eprdata (NEPR > 0)
    */
-  const std::optional< electron::BREME >& BREME() const { return this->breme_; }
+  const std::optional< electron::BREME >& BREME() const {
+
+    this->verifyBlock( Block::BREME );
+    return this->breme_;
+  }
 
   /**
    *  @brief Return the Bremsstrahlung energy distribution block for eprdata (NEPR > 0)
@@ -510,7 +598,11 @@ public:
   /**
    *  @brief Return the electron energy after Brehmsstrahlung block for eprdata (NEPR > 0)
    */
-  const std::optional< electron::BREML >& BREML() const { return this->breml_; }
+  const std::optional< electron::BREML >& BREML() const {
+
+    this->verifyBlock( Block::BREML );
+    return this->breml_;
+  }
 
   /**
    *  @brief Return the electron energy after Brehmsstrahlung block for eprdata (NEPR > 0)
@@ -523,7 +615,11 @@ public:
   /**
    *  @brief Return the additional elastic cross section block for eprdata (NEPR = 3)
    */
-  const std::optional< electron::SELAS >& SELAS() const { return this->selas_; }
+  const std::optional< electron::SELAS >& SELAS() const {
+
+    this->verifyBlock( Block::SELAS );
+    return this->selas_;
+  }
 
   /**
    *  @brief Return the additional elastic cross section block for eprdata (NEPR = 3)
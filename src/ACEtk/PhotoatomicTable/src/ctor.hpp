@@ -1,9 +1,15 @@
 /**
  *  @brief Copy constructor using a generic table
  *
+ *  Only the selected blocks are generated. Requesting a block that was not
+ *  selected results in an exception.
+ *
  *  @param[in] table    the generic table to be copied
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-PhotoatomicTable( const Table& table ): Table( table ) {
+PhotoatomicTable( const Table& table,
+                  BlockSelection blocks = BlockSelection::all() ) :
+  Table( table ), blocks_( blocks ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -12,9 +18,15 @@ PhotoatomicTable( const Table& table ): Table( table ) {
 /**
  *  @brief Move constructor using a generic table
  *
+ *  Only the selected blocks are generated. Requesting a block that was not
+ *  selected results in an exception.
+ *
  *  @param[in] table    the generic table to be moved
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-PhotoatomicTable( Table&& table ): Table( std::move( table ) ) {
+PhotoatomicTable( Table&& table,
+                  BlockSelection blocks = BlockSelection::all() ) :
+  Table( std::move( table ) ), blocks_( blocks ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -26,7 +38,7 @@ PhotoatomicTable( Table&& table ): Table( std::move( table ) ) {
  *  @param[in] table    the photoatomic table to be copied
  */
 PhotoatomicTable( const PhotoatomicTable& table ) :
-  Table( table ) {
+  Table( table ), blocks_( table.blocks_ ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -38,7 +50,7 @@ PhotoatomicTable( const PhotoatomicTable& table ) :
  *  @param[in] table    the photoatomic table to be moved
  */
 PhotoatomicTable( PhotoatomicTable&& table ) :
-  Table( std::move( table ) ) {
+  Table( std::move( table ) ), blocks_( table.blocks_ ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -54,6 +66,7 @@ PhotoatomicTable& operator=( const PhotoatomicTable& base ) {
   if ( this != &base ) {
 
     Table::operator=( base );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
@@ -70,6 +83,7 @@ PhotoatomicTable& operator=( PhotoatomicTable&& base ) {
   if ( this != &base ) {
 
     Table::operator=( std::move( base ) );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
@@ -42,6 +42,12 @@ auto electroionisation_block( std::size_t index ) const {
 
 void generateBlocks() {
 
+  // reset blocks
+  this->eszg_ = photoatomic::ESZG();
+  this->jinc_ = photoatomic::JINC();
+  this->jcoh_ = photoatomic::JCOH();
+  this->lhnm_ = photoatomic::LHNM();
+
   // reset optional blocks
   this->jflo_ = std::nullopt;
   this->eps_ = std::nullopt;
@@ -59,46 +65,61 @@ void generateBlocks() {
   // clear vectors
   eion_.clear();
 
-  // starting iterator into the XSS array
-  auto begin = this->data().XSS().begin();
-
   // principal cross section data
-  auto iterators = block( 1 );
-  this->eszg_ = photoatomic::ESZG( iterators.first, iterators.second, this->NES() );
+  if ( this->blocks_.contains( Block::ESZG ) ) {
+
+    auto iterators = block( 1 );
+    this->eszg_ = photoatomic::ESZG( iterators.first, iterators.second, this->NES() );
+  }
 
   // incoherent scattering functions
-  iterators = block( 2 );
-  this->jinc_ = photoatomic::JINC( iterators.first, iterators.second );
+  if ( this->blocks_.contains( Block::JINC ) ) {
+
+    auto iterators = block( 2 );
+    this->jinc_ = photoatomic::JINC( iterators.first, iterators.second );
+  }
 
   // coherent form factor
-  iterators = block( 3 );
-  this->jcoh_ = photoatomic::JCOH( iterators.first, iterators.second );
+  if ( this->blocks_.contains( Block::JCOH ) ) {
+
+    auto iterators = block( 3 );
+    this->jcoh_ = photoatomic::JCOH( iterators.first, iterators.second );
+  }
 
   // fluorescence data block
   bool present = ( this->NFLO() > 0 );
-  if ( present ) {
+  if ( present && this->blocks_.contains( Block::JFLO ) ) {
 
-    iterators = block( 4 );
+    auto iterators = block( 4 );
     this->jflo_ = photoatomic::JFLO( iterators.first, iterators.second, this->NFLO() );
   }
 
   // heating numbers
-  iterators = block( 5 );
-  this->lhnm_ = photoatomic::LHNM( iterators.first, iterators.second, this->NES() );
+  if ( this->blocks_.contains( Block::LHNM ) ) {
+
+    auto iterators = block( 5 );
+    this->lhnm_ = photoatomic::LHNM( iterators.first, iterators.second, this->NES() );
+  }
 
   present = ( this->NSH() > 0 );
   if ( present ) {
 
     // electron shell block
-    auto locators = block( 6 );
-    iterators = block( 8 );
-    this->eps_ = electron::EPS( locators.first, iterators.second, this->NSH() );
+    if ( this->blocks_.contains( Block::EPS ) ) {
+
+      auto locators = block( 6 );
+      auto iterators = block( 8 );
+      this->eps_ = electron::EPS( locators.first, iterators.second, this->NSH() );
+    }
 
     // compton profile block
-    locators = block( 9 );
-    iterators = block( 10 );
-    this->swd_ = photoatomic::SWD( locators.first, iterators.first, iterators.second,
-                                   this->NSH() );
+    if ( this->blocks_.contains( Block::SWD ) ) {
+
+      auto locators = block( 9 );
+      auto iterators = block( 10 );
+      this->swd_ = photoatomic::SWD( locators.first, iterators.first, iterators.second,
+                                     this->NSH() );
+    }
   }
 
   present = ( this->NEPR() > 0 );
@@ -106,35 +127,62 @@ void generateBlocks() {
 
     auto subsh = block( 11 );
     auto sphel = block( 16 );
-    this->subsh_ = electron::SUBSH( subsh.first, sphel.first, this->NSSH() );
-    this->sphel_ = photoatomic::SPHEL( sphel.first, sphel.second, this->NSSH(), this->NES() );
-    auto relo = block( 17 );
-    auto xprob = block( 18 );
-    this->xprob_ = electron::XPROB( relo.first, xprob.first, xprob.second, this->NSSH() );
-    auto esze = block( 19 );
-    this->esze_ = electron::ESZE( esze.first, esze.second, this->NSSH(), this->NE() );
-    auto excit = block( 20 );
-    this->excit_ = electron::EXCIT( excit.first, excit.second, this->NXL() );
-    auto elasi = block( 21 );
-    auto elas = block( 22 );
-    this->elas_ = electron::ELAS( elasi.first, elas.second, this->NA() );
+    if ( this->blocks_.contains( Block::SUBSH ) ) {
+
+      this->subsh_ = electron::SUBSH( subsh.first, sphel.first, this->NSSH() );
+    }
+    if ( this->blocks_.contains( Block::SPHEL ) ) {
+
+      this->sphel_ = photoatomic::SPHEL( sphel.first, sphel.second, this->NSSH(), this->NES() );
+    }
+    if ( this->blocks_.contains( Block::XPROB ) ) {
+
+      auto relo = block( 17 );
+      auto xprob = block( 18 );
+      this->xprob_ = electron::XPROB( relo.first, xprob.first, xprob.second, this->NSSH() );
+    }
+    if ( this->blocks_.contains( Block::ESZE ) ) {
+
+      auto esze = block( 19 );
+      this->esze_ = electron::ESZE( esze.first, esze.second, this->NSSH(), this->NE() );
+    }
+    if ( this->blocks_.contains( Block::EXCIT ) ) {
+
+      auto excit = block( 20 );
+      this->excit_ = electron::EXCIT( excit.first, excit.second, this->NXL() );
+    }
+    if ( this->blocks_.contains( Block::ELAS ) ) {
+
+      auto elasi = block( 21 );
+      auto elas = block( 22 );
+      this->elas_ = electron::ELAS( elasi.first, elas.second, this->NA() );
+    }
 
     // electronionisation
-    for ( std::size_t index = 1; index <= this->NSSH(); ++index ) {
+    if ( this->blocks_.contains( Block::EION ) ) {
+
+      for ( std::size_t index = 1; index <= this->NSSH(); ++index ) {
 
-      auto eion = electroionisation_block( index );
-      this->eion_.emplace_back( std::get< 0 >( eion ), std::get< 1 >( eion ),
-                                std::get< 2 >( eion ) );
+        auto eion = electroionisation_block( index );
+        this->eion_.emplace_back( std::get< 0 >( eion ), std::get< 1 >( eion ),
+                                  std::get< 2 >( eion ) );
+      }
     }
 
-    auto bremi = block( 24 );
-    auto breme = block( 25 );
-    this->breme_ = electron::BREME( bremi.first, breme.second, this->NB() );
-    auto breml = block( 26 );
-    this->breml_ = electron::BREML( breml.first, breml.second, this->NBL() );
+    if ( this->blocks_.contains( Block::BREME ) ) {
+
+      auto bremi = block( 24 );
+      auto breme = block( 25 );
+      this->breme_ = electron::BREME( bremi.first, breme.second, this->NB() );
+    }
+    if ( this->blocks_.contains( Block::BREML ) ) {
+
+      auto breml = block( 26 );
+      this->breml_ = electron::BREML( breml.first, breml.second, this->NBL() );
+    }
 
     present = ( this->NEPR() == 3 );
-    if ( present ) {
+    if ( present && this->blocks_.contains( Block::SELAS ) ) {
 
       auto selas = block( 27 );
       this->selas_ = electron::SELAS( selas.first, selas.second, this->NE() );
@@ -0,0 +1,9 @@
+void verifyBlock( Block block ) const {
+
+  if ( not this->blocks_.contains( block ) ) {
+
+    Log::error( "The requested block was not selected for loading" );
+    Log::info( "Block index: {}", static_cast< unsigned int >( block ) );
+    throw std::exception();
+  }
+}
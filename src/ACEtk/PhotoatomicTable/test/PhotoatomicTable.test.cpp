@@ -83,6 +83,24 @@ SCENARIO( "PhotoatomicTable" ) {
       } // THEN
     } // WHEN
 
+    WHEN( "constructing a PhotoatomicTable with a block selection" ) {
+
+      PhotoatomicTable full( fromFile( "1000.01p" ) );
+      PhotoatomicTable chunk( fromFile( "1000.01p" ),
+                              PhotoatomicTable::Block::ESZG );
+
+      THEN( "only the selected blocks are available" ) {
+
+        CHECK( full.ESZG().length() == chunk.ESZG().length() );
+        CHECK( full.ESZG().energies().front() == chunk.ESZG().energies().front() );
+        CHECK( full.ESZG().energies().back() == chunk.ESZG().energies().back() );
+        CHECK( full.ESZG().incoherent().back() == chunk.ESZG().incoherent().back() );
+        CHECK_THROWS( chunk.JINC() );
+        CHECK_THROWS( chunk.JCOH() );
+        CHECK_THROWS( chunk.LHNM() );
+      } // THEN
+    } // WHEN
+
     WHEN( "constructing a PhotoatomicTable from its components" ) {
 
       PhotoatomicTable base( fromFile( "1000.01p" ) );
@@ -5,6 +5,7 @@
 
 // other includes
 #include "ACEtk/Table.hpp"
+#include "ACEtk/BlockSelection.hpp"
 #include "ACEtk/photonuclear/PrincipalCrossSectionBlock.hpp"
 #include "ACEtk/continuous/ReactionNumberBlock.hpp"
 #include "ACEtk/continuous/ReactionQValueBlock.hpp"
@@ -27,7 +28,31 @@ namespace ACEtk {
  */
 class PhotonuclearTable : protected Table {
 
+public:
+
+  /* type aliases */
+
+  /**
+   *  @brief The blocks of the table that can be selected for loading
+   */
+  enum class Block : unsigned int {
+
+    ESZ = 0, MTR, LQR, SIG, IXS, PXS, PHN, MTRH, TYRH, SIGH, ANDH, DLWH
+  };
+  using BlockSelection = ACEtk::BlockSelection< Block >;
+
+  /**
+   *  @brief Combine two blocks into a block selection
+   */
+  friend constexpr BlockSelection operator|( Block left, Block right ) {
+
+    return BlockSelection( left ) | right;
+  }
+
+private:
+
   /* fields */
+  BlockSelection blocks_;
   photonuclear::ESZU eszu_;
   continuous::MTR mtr_;
   continuous::LQR lqr_;
@@ -47,15 +72,23 @@ class PhotonuclearTable : protected Table {
   #include "ACEtk/PhotonuclearTable/src/generateBlocks.hpp"
   #include "ACEtk/PhotonuclearTable/src/generateData.hpp"
   #include "ACEtk/PhotonuclearTable/src/verifyType.hpp"
+  #include "ACEtk/PhotonuclearTable/src/verifyBlock.hpp"
 
 public:
 
   #include "ACEtk/PhotonuclearTable/src/ctor.hpp"
 
   using Table::header;
-  using Table::data;
   using Table::print;
 
+  /**
+   *  @brief Return the data arrays
+   *
+   *  The blocks of the table refer to the XSS array so only const access to
+   *  the data arrays is provided.
+   */
+  const Data& data() const { return Table::data(); }
+
   //! @todo projectile() function
   //! @todo target() function
 
@@ -188,7 +221,11 @@ public:
   /**
    *  @brief Return the principal cross section block
    */
-  const photonuclear::ESZU& ESZ() const { return this->eszu_; }
+  const photonuclear::ESZU& ESZ() const {
+
+    this->verifyBlock( Block::ESZ );
+    return this->eszu_;
+  }
 
   /**
    *  @brief Return the principal cross section block
@@ -198,7 +235,11 @@ public:
   /**
    *  @brief Return the reaction number block
    */
-  const continuous::MTR& MTR() const { return this->mtr_; }
+  const continuous::MTR& MTR() const {
+
+    this->verifyBlock( Block::MTR );
+    return this->mtr_;
+  }
 
   /**
    *  @brief Return the reaction number block
@@ -208,7 +249,11 @@ public:
   /**
    *  @brief Return the reaction Q value block
    */
-  const continuous::LQR& LQR() const { return this->lqr_; }
+  const continuous::LQR& LQR() const {
+
+    this->verifyBlock( Block::LQR );
+    return this->lqr_;
+  }
 
   /**
    *  @brief Return the reaction Q value block
@@ -218,7 +263,11 @@ public:
   /**
    *  @brief Return the cross section block
    */
-  const continuous::SIG& SIG() const { return this->sig_; }
+  const continuous::SIG& SIG() const {
+
+    this->verifyBlock( Block::SIG );
+    return this->sig_;
+  }
 
   /**
    *  @brief Return the cross section block
@@ -228,7 +277,11 @@ public:
   /**
    *  @brief Return the secondary particle information and locator block
    */
-  const std::optional< photonuclear::IXSU >& IXS() const { return this->ixsu_; }
+  const std::optional< photonuclear::IXSU >& IXS() const {
+
+    this->verifyBlock( Block::IXS );
+    return this->ixsu_;
+  }
 
   /**
    *  @brief Return the secondary particle information and locator block
@@ -249,6 +302,7 @@ public:
    */
   const continuous::CrossSectionData& PXS( std::size_t index ) const {
 
+    this->verifyBlock( Block::PXS );
     return this->pxs_[ index - 1 ];
   }
 
@@ -278,6 +332,7 @@ public:
    */
   const continuous::CrossSectionData& PHN( std::size_t index ) const {
 
+    this->verifyBlock( Block::PHN );
     return this->phn_[ index - 1 ];
   }
 
@@ -306,6 +361,7 @@ public:
    */
   const continuous::MTRH& MTRH( std::size_t index ) const {
 
+    this->verifyBlock( Block::MTRH );
     return this->mtrh_[ index - 1 ];
   }
 
@@ -333,6 +389,7 @@ public:
    */
   const continuous::TYRH& TYRH( std::size_t index ) const {
 
+    this->verifyBlock( Block::TYRH );
     return this->tyrh_[ index - 1 ];
   }
 
@@ -361,6 +418,7 @@ public:
    */
   const continuous::SIGH& SIGH( std::size_t index ) const {
 
+    this->verifyBlock( Block::SIGH );
     return this->sigh_[ index - 1 ];
   }
 
@@ -389,6 +447,7 @@ public:
    */
   const continuous::ANDH& ANDH( std::size_t index ) const {
 
+    this->verifyBlock( Block::ANDH );
     return this->andh_[ index - 1 ];
   }
 
@@ -417,6 +476,7 @@ public:
    */
   const continuous::DLWH& DLWH( std::size_t index ) const {
 
+    this->verifyBlock( Block::DLWH );
     return this->dlwh_[ index - 1 ];
   }
 
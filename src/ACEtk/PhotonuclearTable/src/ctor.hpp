@@ -1,9 +1,15 @@
 /**
  *  @brief Copy constructor using a generic table
  *
+ *  Only the selected blocks (and the blocks they depend on) are generated.
+ *  Requesting a block that was not selected results in an exception.
+ *
  *  @param[in] table    the generic table to be copied
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-PhotonuclearTable( const Table& table ): Table( table ) {
+PhotonuclearTable( const Table& table,
+                   BlockSelection blocks = BlockSelection::all() ) :
+  Table( table ), blocks_( blocks ) {
 
   this->verifyType();
   this->setSZA();
@@ -13,9 +19,15 @@ PhotonuclearTable( const Table& table ): Table( table ) {
 /**
  *  @brief Move constructor using a generic table
  *
+ *  Only the selected blocks (and the blocks they depend on) are generated.
+ *  Requesting a block that was not selected results in an exception.
+ *
  *  @param[in] table    the generic table to be moved
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-PhotonuclearTable( Table&& table ): Table( std::move( table ) ) {
+PhotonuclearTable( Table&& table,
+                   BlockSelection blocks = BlockSelection::all() ) :
+  Table( std::move( table ) ), blocks_( blocks ) {
 
   this->verifyType();
   this->setSZA();
@@ -28,7 +40,7 @@ PhotonuclearTable( Table&& table ): Table( std::move( table ) ) {
  *  @param[in] table    the photonuclear table to be copied
  */
 PhotonuclearTable( const PhotonuclearTable& table ) :
-  Table( table ) {
+  Table( table ), blocks_( table.blocks_ ) {
 
   this->verifyType();
   this->setSZA();
@@ -41,7 +53,7 @@ PhotonuclearTable( const PhotonuclearTable& table ) :
  *  @param[in] table    the photonuclear table to be moved
  */
 PhotonuclearTable( PhotonuclearTable&& table ) :
-  Table( std::move( table ) ) {
+  Table( std::move( table ) ), blocks_( table.blocks_ ) {
 
   this->verifyType();
   this->setSZA();
@@ -58,6 +70,7 @@ PhotonuclearTable& operator=( const PhotonuclearTable& base ) {
   if ( this != &base ) {
 
     Table::operator=( base );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
@@ -74,6 +87,7 @@ PhotonuclearTable& operator=( PhotonuclearTable&& base ) {
   if ( this != &base ) {
 
     Table::operator=( std::move( base ) );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
@@ -49,6 +49,26 @@ auto block( std::size_t particle, std::size_t index ) const {
 
 void generateBlocks() {
 
+  // blocks used by other blocks are always generated
+  for ( auto dependent : { Block::PXS, Block::PHN, Block::MTRH, Block::TYRH,
+                           Block::SIGH, Block::ANDH, Block::DLWH } ) {
+
+    if ( this->blocks_.contains( dependent ) ) {
+
+      this->blocks_ |= Block::IXS;
+    }
+  }
+  if ( this->blocks_.contains( Block::DLWH ) ) {
+
+    this->blocks_ |= Block::TYRH;
+  }
+
+  // reset blocks
+  this->eszu_ = photonuclear::ESZU();
+  this->mtr_ = continuous::MTR();
+  this->lqr_ = continuous::LQR();
+  this->sig_ = continuous::SIG();
+
   // reset optional blocks
   this->ixsu_ = std::nullopt;
 
@@ -61,79 +81,110 @@ void generateBlocks() {
   this->andh_.clear();
   this->dlwh_.clear();
 
-  // starting iterator into the XSS array
-  auto begin = this->data().XSS().begin();
-
   // principal cross section block
-  unsigned int size = 3;
-  if ( this->data().JXS(4) != 0 ) {
+  if ( this->blocks_.contains( Block::ESZ ) ) {
 
-    size += 1;
+    unsigned int size = 3;
+    if ( this->data().JXS(4) != 0 ) {
+
+      size += 1;
+    }
+    auto locators = block( 1 );
+    auto iterators = block( 6 );
+    this->eszu_ = photonuclear::ESZU( locators.first, iterators.first, this->NES(), size );
   }
-  auto locators = block( 1 );
-  auto iterators = block( 6 );
-  this->eszu_ = photonuclear::ESZU( locators.first, iterators.first, this->NES(), size );
 
   // reaction number block
-  iterators = block( 6 );
-  this->mtr_ = continuous::MTR( iterators.first, iterators.second, this->NTR() );
+  if ( this->blocks_.contains( Block::MTR ) ) {
+
+    auto iterators = block( 6 );
+    this->mtr_ = continuous::MTR( iterators.first, iterators.second, this->NTR() );
+  }
 
   // Q value block
-  iterators = block( 7 );
-  this->lqr_ = continuous::LQR( iterators.first, iterators.second, this->NTR() );
+  if ( this->blocks_.contains( Block::LQR ) ) {
+
+    auto iterators = block( 7 );
+    this->lqr_ = continuous::LQR( iterators.first, iterators.second, this->NTR() );
+  }
 
   // cross section block
-  locators = block( 8 );
-  iterators = block( 9 );
-  this->sig_ = continuous::SIG( locators.first, iterators.first, iterators.second,
-                                this->NTR() );
+  if ( this->blocks_.contains( Block::SIG ) ) {
+
+    auto locators = block( 8 );
+    auto iterators = block( 9 );
+    this->sig_ = continuous::SIG( locators.first, iterators.first, iterators.second,
+                                  this->NTR() );
+  }
 
   // secondary particles
   bool present = ( this->NTYPE() > 0 );
-  if ( present ) {
+  if ( present && this->blocks_.contains( Block::IXS ) ) {
 
     // secondary particle information and locator block
-    iterators = block( 10 );
+    auto iterators = block( 10 );
     this->ixsu_ = photonuclear::IXSU( iterators.first, iterators.second, this->NTYPE() );
 
     // secondary particle data: data blocks
+    decltype( iterators ) locators;
     for ( std::size_t index = 1; index <= this->NTYPE(); ++index ) {
 
       // secondary particle data: total production cross section
-      iterators = block( index, 3 );
-      this->pxs_.emplace_back( iterators.first, iterators.second );
+      if ( this->blocks_.contains( Block::PXS ) ) {
+
+        iterators = block( index, 3 );
+        this->pxs_.emplace_back( iterators.first, iterators.second );
+      }
 
       // secondary particle data: average heating cross section
-      iterators = block( index, 4 );
-      this->phn_.emplace_back( iterators.first, iterators.second );
+      if ( this->blocks_.contains( Block::PHN ) ) {
+
+        iterators = block( index, 4 );
+        this->phn_.emplace_back( iterators.first, iterators.second );
+      }
 
       // secondary particle data: reaction numbers
-      iterators = block( index, 5 );
-      this->mtrh_.emplace_back( iterators.first, iterators.second,
-                                this->IXS()->NP( index ) );
+      if ( this->blocks_.contains( Block::MTRH ) ) {
+
+        iterators = block( index, 5 );
+        this->mtrh_.emplace_back( iterators.first, iterators.second,
+                                  this->IXS()->NP( index ) );
+      }
 
       // secondary particle data: reference frame and multiplicity
-      iterators = block( index, 6 );
-      this->tyrh_.emplace_back( iterators.first, iterators.second,
-                                this->IXS()->NP( index ) );
+      if ( this->blocks_.contains( Block::TYRH ) ) {
+
+        iterators = block( index, 6 );
+        this->tyrh_.emplace_back( iterators.first, iterators.second,
+                                  this->IXS()->NP( index ) );
+      }
 
       // secondary particle data: production cross section data
-      locators = block( index, 7 );
-      iterators = block( index, 8 );
-      this->sigh_.emplace_back( locators.first, iterators.first, iterators.second,
-                                this->IXS()->NP( index ) );
+      if ( this->blocks_.contains( Block::SIGH ) ) {
+
+        locators = block( index, 7 );
+        iterators = block( index, 8 );
+        this->sigh_.emplace_back( locators.first, iterators.first, iterators.second,
+                                  this->IXS()->NP( index ) );
+      }
 
       // secondary particle data: angular distributions
-      locators = block( index, 9 );
-      iterators = block( index, 10 );
-      this->andh_.emplace_back( locators.first, iterators.first, iterators.second,
-                                this->IXS()->NP( index ) );
+      if ( this->blocks_.contains( Block::ANDH ) ) {
+
+        locators = block( index, 9 );
+        iterators = block( index, 10 );
+        this->andh_.emplace_back( locators.first, iterators.first, iterators.second,
+                                  this->IXS()->NP( index ) );
+      }
 
       // secondary particle data: energy distributions
-      locators = block( index, 11 );
-      iterators = block( index, 12 );
-      this->dlwh_.emplace_back( locators.first, iterators.first, iterators.second,
-                                this->TYRH( index ), this->IXS()->NP( index ) );
+      if ( this->blocks_.contains( Block::DLWH ) ) {
+
+        locators = block( index, 11 );
+        iterators = block( index, 12 );
+        this->dlwh_.emplace_back( locators.first, iterators.first, iterators.second,
+                                  this->TYRH( index ), this->IXS()->NP( index ) );
+      }
     }
   }
 }
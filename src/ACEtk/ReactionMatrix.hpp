@@ -0,0 +1,127 @@
+#ifndef NJOY_ACETK_REACTIONMATRIX
+#define NJOY_ACETK_REACTIONMATRIX
+
+// system includes
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// other includes
+#include "ACEtk/MatrixLayout.hpp"
+#include "ACEtk/ContinuousEnergyTable.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A dense matrix with the reaction cross sections of a continuous
+ *         energy table on the energy grid of the ESZ block
+ *
+ *  The matrix has a row for each energy point of the ESZ block and a column
+ *  for each reaction of the SIG block (in the order of the MTR block). The
+ *  photon production cross sections in the SIGP block can be added as
+ *  additional columns (in the order of the MTRP block). Only the photon
+ *  production data given as cross sections (MFTYPE = 13) is added since the
+ *  data given as multiplicities is not tabulated on the energy grid. For the
+ *  same reason, the SIGH block is never added.
+ *
+ *  Cross section values below the first energy point of a reaction (the
+ *  threshold) and above its last energy point are zero.
+ *
+ *  The values are stored in row-major or column-major order. The leading
+ *  dimension (the number of columns or rows) is padded so that every row or
+ *  column starts on a 64-byte boundary. The padding values are zero.
+ *
+ *  @tparam Real   the floating point type of the values (e.g. double or float)
+ */
+template< typename Real = double >
+class ReactionMatrix {
+
+  static_assert( std::is_floating_point_v< Real >,
+                 "the value type of a reaction matrix must be a floating "
+                 "point type" );
+
+public:
+
+  /** @brief The alignment of the rows or columns (in bytes) */
+  static constexpr std::size_t alignment = 64;
+
+  #include "ACEtk/ReactionMatrix/AlignedAllocator.hpp"
+
+private:
+
+  /* fields */
+  MatrixLayout layout_ = MatrixLayout::ColumnMajor;
+  std::size_t rows_ = 0;
+  std::size_t columns_ = 0;
+  std::size_t stride_ = 0;
+  std::vector< unsigned int > reactions_;
+  std::vector< Real, AlignedAllocator< Real > > values_;
+
+  /* auxiliary functions */
+  #include "ACEtk/ReactionMatrix/src/pad.hpp"
+  #include "ACEtk/ReactionMatrix/src/fill.hpp"
+
+public:
+
+  /* constructor */
+  #include "ACEtk/ReactionMatrix/src/ctor.hpp"
+
+  /**
+   *  @brief Return the storage layout of the matrix
+   */
+  MatrixLayout layout() const { return this->layout_; }
+
+  /**
+   *  @brief Return the number of rows (the number of energy points)
+   */
+  std::size_t numberRows() const { return this->rows_; }
+
+  /**
+   *  @brief Return the number of columns (the number of reactions)
+   */
+  std::size_t numberColumns() const { return this->columns_; }
+
+  /**
+   *  @brief Return the leading dimension of the matrix
+   *
+   *  The leading dimension is the distance between the start of two rows
+   *  (row-major order) or two columns (column-major order). It is the number
+   *  of columns or rows, padded to a multiple of the alignment.
+   */
+  std::size_t leadingDimension() const { return this->stride_; }
+
+  /**
+   *  @brief Return the reaction numbers of the columns
+   */
+  const std::vector< unsigned int >& reactionNumbers() const {
+
+    return this->reactions_;
+  }
+
+  /**
+   *  @brief Return a pointer to the (aligned) values of the matrix
+   */
+  const Real* data() const { return this->values_.data(); }
+
+  /**
+   *  @brief Return a value of the matrix
+   *
+   *  @param[in] row      the row index (zero-based)
+   *  @param[in] column   the column index (zero-based)
+   */
+  Real operator()( std::size_t row, std::size_t column ) const {
+
+    return this->layout_ == MatrixLayout::RowMajor
+           ? this->values_[ row * this->stride_ + column ]
+           : this->values_[ column * this->stride_ + row ];
+  }
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
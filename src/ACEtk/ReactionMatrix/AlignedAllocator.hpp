@@ -0,0 +1,31 @@
+/**
+ *  @class
+ *  @brief An allocator returning storage aligned on the matrix alignment
+ */
+template< typename T >
+struct AlignedAllocator {
+
+  using value_type = T;
+
+  AlignedAllocator() = default;
+  template< typename U >
+  AlignedAllocator( const AlignedAllocator< U >& ) {}
+
+  T* allocate( std::size_t size ) {
+
+    return static_cast< T* >(
+               ::operator new( size * sizeof( T ),
+                               std::align_val_t( alignment ) ) );
+  }
+
+  void deallocate( T* pointer, std::size_t ) {
+
+    ::operator delete( pointer, std::align_val_t( alignment ) );
+  }
+
+  template< typename U >
+  bool operator==( const AlignedAllocator< U >& ) const { return true; }
+
+  template< typename U >
+  bool operator!=( const AlignedAllocator< U >& ) const { return false; }
+};
@@ -0,0 +1,61 @@
+ReactionMatrix() = default;
+
+ReactionMatrix( const ReactionMatrix& ) = default;
+ReactionMatrix( ReactionMatrix&& ) = default;
+
+ReactionMatrix& operator=( const ReactionMatrix& ) = default;
+ReactionMatrix& operator=( ReactionMatrix&& ) = default;
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] table              the continuous energy table
+ *  @param[in] layout             the storage layout (default: column-major)
+ *  @param[in] photonProduction   the flag to add the photon production cross
+ *                                sections (default: false)
+ */
+ReactionMatrix( const ContinuousEnergyTable& table,
+                MatrixLayout layout = MatrixLayout::ColumnMajor,
+                bool photonProduction = false ) :
+  layout_( layout ), rows_( table.ESZ().NES() ) {
+
+  const auto& sig = table.SIG();
+  for ( std::size_t index = 1; index <= sig.NTR(); ++index ) {
+
+    this->reactions_.push_back( table.MTR().MT( index ) );
+  }
+
+  // photon production data given as cross sections
+  std::vector< const continuous::PhotonProductionCrossSectionData* > photons;
+  if ( photonProduction && table.SIGP() ) {
+
+    const auto& sigp = table.SIGP().value();
+    for ( std::size_t index = 1; index <= sigp.NTRP(); ++index ) {
+
+      const auto* data = std::get_if< continuous::PhotonProductionCrossSectionData >(
+                             &sigp.crossSectionData( index ) );
+      if ( data ) {
+
+        photons.push_back( data );
+        this->reactions_.push_back( table.MTRP()->MT( index ) );
+      }
+    }
+  }
+
+  this->columns_ = this->reactions_.size();
+  this->stride_ = pad( layout == MatrixLayout::RowMajor ? this->columns_
+                                                        : this->rows_ );
+  this->values_.assign( this->stride_ * ( layout == MatrixLayout::RowMajor
+                                          ? this->rows_ : this->columns_ ),
+                        Real( 0 ) );
+
+  std::size_t column = 0;
+  for ( const auto& data : sig.data() ) {
+
+    this->fill( column++, data.energyIndex(), data.crossSections() );
+  }
+  for ( const auto* data : photons ) {
+
+    this->fill( column++, data->energyIndex(), data->crossSections() );
+  }
+}
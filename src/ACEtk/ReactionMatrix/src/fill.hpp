@@ -0,0 +1,20 @@
+/**
+ *  @brief Fill a column of the matrix with cross section values
+ *
+ *  @param[in] column        the column index (zero-based)
+ *  @param[in] energyIndex   the energy index of the first value (one-based)
+ *  @param[in] values        the cross section values
+ */
+template< typename Range >
+void fill( std::size_t column, std::size_t energyIndex, const Range& values ) {
+
+  std::size_t row = energyIndex - 1;
+  for ( auto iter = values.begin();
+        ( iter != values.end() ) && ( row < this->rows_ ); ++iter, ++row ) {
+
+    const std::size_t position = this->layout_ == MatrixLayout::RowMajor
+                                 ? row * this->stride_ + column
+                                 : column * this->stride_ + row;
+    this->values_[ position ] = static_cast< Real >( *iter );
+  }
+}
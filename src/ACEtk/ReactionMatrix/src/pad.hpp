@@ -0,0 +1,10 @@
+/**
+ *  @brief Return a number of values padded to a multiple of the alignment
+ *
+ *  @param[in] size   the number of values
+ */
+static std::size_t pad( std::size_t size ) {
+
+  constexpr std::size_t block = alignment / sizeof( Real );
+  return ( size + block - 1 ) / block * block;
+}
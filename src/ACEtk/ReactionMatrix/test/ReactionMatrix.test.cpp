@@ -0,0 +1,107 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/ReactionMatrix.hpp"
+
+// other includes
+#include <cstdint>
+#include "ACEtk/fromFile.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+template< typename Real >
+void verifyMatrix( const ReactionMatrix< Real >&, const ContinuousEnergyTable& );
+
+SCENARIO( "ReactionMatrix" ) {
+
+  GIVEN( "a ContinuousEnergyTable - He3" ) {
+
+    ContinuousEnergyTable table( fromFile( "2003.710nc" ) );
+
+    WHEN( "a column-major matrix is constructed" ) {
+
+      ReactionMatrix<> matrix( table );
+
+      THEN( "the matrix can be tested" ) {
+
+        CHECK( MatrixLayout::ColumnMajor == matrix.layout() );
+        CHECK( 696 == matrix.leadingDimension() );
+        verifyMatrix( matrix, table );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a row-major matrix is constructed" ) {
+
+      ReactionMatrix<> matrix( table, MatrixLayout::RowMajor );
+
+      THEN( "the matrix can be tested" ) {
+
+        CHECK( MatrixLayout::RowMajor == matrix.layout() );
+        CHECK( 8 == matrix.leadingDimension() );
+        verifyMatrix( matrix, table );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a single precision matrix is constructed" ) {
+
+      ReactionMatrix< float > column( table );
+      ReactionMatrix< float > row( table, MatrixLayout::RowMajor );
+
+      THEN( "the matrix can be tested" ) {
+
+        CHECK( 704 == column.leadingDimension() );
+        CHECK( 16 == row.leadingDimension() );
+        verifyMatrix( column, table );
+        verifyMatrix( row, table );
+      } // THEN
+    } // WHEN
+
+    WHEN( "photon production is requested for a table without it" ) {
+
+      ReactionMatrix<> matrix( table, MatrixLayout::ColumnMajor, true );
+
+      THEN( "only the reaction cross sections are added" ) {
+
+        verifyMatrix( matrix, table );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+template< typename Real >
+void verifyMatrix( const ReactionMatrix< Real >& matrix,
+                   const ContinuousEnergyTable& table ) {
+
+  CHECK( 693 == matrix.numberRows() );
+  CHECK( 8 == matrix.numberColumns() );
+  CHECK( 8 == matrix.reactionNumbers().size() );
+  CHECK( 0 == reinterpret_cast< std::uintptr_t >( matrix.data() ) %
+              ReactionMatrix< Real >::alignment );
+
+  const auto& sig = table.SIG();
+  for ( std::size_t index = 1; index <= sig.NTR(); ++index ) {
+
+    const std::size_t column = index - 1;
+    const std::size_t first = sig.energyIndex( index ) - 1;
+    const auto values = sig.crossSections( index );
+
+    CHECK( table.MTR().MT( index ) == matrix.reactionNumbers()[ column ] );
+    for ( std::size_t row = 0; row < first; ++row ) {
+
+      CHECK( 0. == matrix( row, column ) );
+    }
+    for ( std::size_t i = 0; i < values.size(); ++i ) {
+
+      CHECK_THAT( static_cast< Real >( values[i] ),
+                  WithinRel( matrix( first + i, column ) ) );
+    }
+    for ( std::size_t row = first + values.size(); row < matrix.numberRows(); ++row ) {
+
+      CHECK( 0. == matrix( row, column ) );
+    }
+  }
+}
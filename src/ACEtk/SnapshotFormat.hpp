@@ -0,0 +1,69 @@
+#ifndef NJOY_ACETK_SNAPSHOTFORMAT
+#define NJOY_ACETK_SNAPSHOTFORMAT
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/BinaryIO.hpp"
+#include "ACEtk/Table.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief Reading and writing ACE tables in the ACEtk snapshot format
+ *
+ *  The snapshot format is a native binary container for a single ACE table
+ *  that is meant to be loaded as fast as possible (e.g. from a memory mapped
+ *  file). It is not portable between machines with a different byte order.
+ *
+ *  A snapshot consists of:
+ *    - a 64 byte preamble: the magic string "ACEtkSNP", the format version
+ *      and a byte order marker (4 byte integers), the length of the header
+ *      text, the offset and length of the XSS array and the checksum of the
+ *      XSS array (8 byte integers)
+ *    - the IZ array (16 integers of 4 bytes), the AW array (16 reals of 8
+ *      bytes), the NXS and JXS arrays (integers of 8 bytes)
+ *    - the header as it appears in an ACE file (legacy or 2.0.x header,
+ *      including the comments)
+ *    - the XSS array, starting on a 64 byte boundary
+ */
+class SnapshotFormat {
+
+public:
+
+  /**
+   *  @brief Return the magic string identifying a snapshot
+   */
+  static constexpr const char* magic() { return "ACEtkSNP"; }
+
+  /**
+   *  @brief Return the snapshot format version
+   */
+  static constexpr std::uint32_t version() { return 1; }
+
+  /**
+   *  @brief Return the alignment of the XSS array (in bytes)
+   */
+  static constexpr std::size_t alignment() { return 64; }
+
+  #include "ACEtk/SnapshotFormat/src/checksum.hpp"
+  #include "ACEtk/SnapshotFormat/src/read.hpp"
+  #include "ACEtk/SnapshotFormat/src/write.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,22 @@
+/**
+ *  @brief Calculate the checksum of an array of values
+ *
+ *  This is a Fletcher style checksum over the 64-bit words of the array,
+ *  which is fast enough to be verified every time a snapshot is loaded.
+ *
+ *  @param[in] values   a pointer to the first value
+ *  @param[in] size     the number of values
+ */
+static std::uint64_t checksum( const double* values, std::size_t size ) {
+
+  std::uint64_t first = 0;
+  std::uint64_t second = 0;
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    std::uint64_t word;
+    std::memcpy( &word, values + i, sizeof( word ) );
+    first += word;
+    second += first;
+  }
+  return first ^ ( ( second << 32 ) | ( second >> 32 ) );
+}
@@ -0,0 +1,75 @@
+/**
+ *  @brief Read an ACE table from a snapshot in memory
+ *
+ *  The XSS array is copied from the buffer in a single operation, no
+ *  parsing is involved.
+ *
+ *  @param[in] begin    the start of the snapshot
+ *  @param[in] end      the end of the snapshot
+ *  @param[in] verify   flag to verify the checksum of the XSS array
+ */
+static Table read( const char* begin, const char* end, bool verify = true ) {
+
+  // preamble
+  const char* position = begin;
+  if ( ( end - begin < 64 ) || ( std::string( begin, 8 ) != magic() ) ) {
+
+    Log::error( "The buffer does not contain an ACE table snapshot" );
+    throw std::exception();
+  }
+  position += 8;
+
+  const auto format = BinaryIO::unpack< std::uint32_t >( position, end );
+  const auto order = BinaryIO::unpack< std::uint32_t >( position, end );
+  if ( format != version() ) {
+
+    Log::error( "The ACE table snapshot has an unsupported format version" );
+    Log::info( "Format version: {}", format );
+    Log::info( "Supported format version: {}", version() );
+    throw std::exception();
+  }
+  if ( order != 0x01020304 ) {
+
+    Log::error( "The ACE table snapshot was written on a machine with a "
+                "different byte order" );
+    throw std::exception();
+  }
+
+  const auto length = BinaryIO::unpack< std::uint64_t >( position, end );
+  const auto offset = BinaryIO::unpack< std::uint64_t >( position, end );
+  const auto size = BinaryIO::unpack< std::uint64_t >( position, end );
+  const auto sum = BinaryIO::unpack< std::uint64_t >( position, end );
+  position = begin + 64;
+
+  // arrays
+  std::pair< std::array< int32_t, 16 >, std::array< double, 16 > > izaw;
+  std::array< int64_t, 16 > nxs;
+  std::array< int64_t, 32 > jxs;
+  for ( auto& value : izaw.first ) { value = BinaryIO::unpack< std::int32_t >( position, end ); }
+  for ( auto& value : izaw.second ) { value = BinaryIO::unpack< double >( position, end ); }
+  for ( auto& value : nxs ) { value = BinaryIO::unpack< std::int64_t >( position, end ); }
+  for ( auto& value : jxs ) { value = BinaryIO::unpack< std::int64_t >( position, end ); }
+
+  // header text and XSS array
+  const std::size_t available = end - begin;
+  if ( ( length > available - ( position - begin ) ) || ( offset > available ) ||
+       ( size > ( available - offset ) / sizeof( double ) ) ) {
+
+    Log::error( "The ACE table snapshot is truncated" );
+    throw std::exception();
+  }
+
+  std::vector< double > xss( size );
+  std::memcpy( xss.data(), begin + offset, size * sizeof( double ) );
+  if ( verify && ( checksum( xss.data(), xss.size() ) != sum ) ) {
+
+    Log::error( "The checksum of the XSS array in the ACE table snapshot "
+                "does not match" );
+    throw std::exception();
+  }
+
+  State< const char* > header{ 1, position, position + length };
+  return Table( Table::readHeader( header ),
+                Table::Data( std::move( izaw ), std::move( nxs ),
+                             std::move( jxs ), std::move( xss ) ) );
+}
@@ -0,0 +1,55 @@
+/**
+ *  @brief Write an ACE table as a snapshot
+ *
+ *  The stream is assumed to be positioned at the start of the snapshot,
+ *  which must be 64 byte aligned for the XSS array to be aligned in memory
+ *  (this is always the case at the start of a file).
+ *
+ *  @param[in] table   the ACE table to be written
+ *  @param[in] out     the output stream (opened in binary mode)
+ */
+static void write( const Table& table, std::ostream& out ) {
+
+  std::ostringstream header;
+  std::visit( [&header] ( const auto& value ) { value.print( header ); },
+              table.header() );
+  const std::string text = header.str();
+
+  const auto& data = table.data();
+  const auto& xss = data.XSS();
+  const std::size_t arrays = 64 + 128 + 128 + 256;
+  const std::size_t offset = ( 64 + arrays + text.size() + alignment() - 1 )
+                             / alignment() * alignment();
+
+  // preamble
+  out.write( magic(), 8 );
+  BinaryIO::pack( out, version() );
+  BinaryIO::pack( out, std::uint32_t{ 0x01020304 } );
+  BinaryIO::pack( out, std::uint64_t{ text.size() } );
+  BinaryIO::pack( out, std::uint64_t{ offset } );
+  BinaryIO::pack( out, std::uint64_t{ xss.size() } );
+  BinaryIO::pack( out, checksum( xss.data(), xss.size() ) );
+  BinaryIO::pack( out, std::uint64_t{ 0 } );
+  BinaryIO::pack( out, std::uint64_t{ 0 } );
+
+  // arrays
+  for ( auto value : data.IZ() ) { BinaryIO::pack( out, std::int32_t{ value } ); }
+  for ( auto value : data.AW() ) { BinaryIO::pack( out, value ); }
+  for ( auto value : data.NXS() ) { BinaryIO::pack( out, std::int64_t{ value } ); }
+  for ( auto value : data.JXS() ) { BinaryIO::pack( out, std::int64_t{ value } ); }
+
+  // header text and padding
+  out.write( text.data(), text.size() );
+  const std::string padding( offset - 64 - arrays - text.size(), '\0' );
+  out.write( padding.data(), padding.size() );
+
+  // XSS array
+  out.write( reinterpret_cast< const char* >( xss.data() ),
+             xss.size() * sizeof( double ) );
+
+  if ( not out ) {
+
+    Log::error( "Could not write the ACE table snapshot" );
+    throw std::exception();
+  }
+}
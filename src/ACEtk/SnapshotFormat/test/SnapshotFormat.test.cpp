@@ -0,0 +1,216 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/SnapshotFormat.hpp"
+#include "ACEtk/fromSnapshotFile.hpp"
+
+// other includes
+#include <cstring>
+#include <sstream>
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+std::string chunk();
+std::string chunkWith201Header();
+void verifyHeader( const Table& );
+void verifyChunk( const Table& );
+
+SCENARIO( "SnapshotFormat" ) {
+
+  GIVEN( "an ACE table with a legacy header" ) {
+
+    std::string string = chunk();
+    State< std::string::iterator > state{ 1, string.begin(), string.end() };
+    Table table( state );
+
+    WHEN( "the table is written as a snapshot" ) {
+
+      std::ostringstream out;
+      SnapshotFormat::write( table, out );
+      std::string snapshot = out.str();
+
+      THEN( "the XSS array is aligned and at the end of the snapshot" ) {
+
+        std::uint64_t offset = 0;
+        std::memcpy( &offset, snapshot.data() + 24, sizeof( offset ) );
+        CHECK( "ACEtkSNP" == snapshot.substr( 0, 8 ) );
+        CHECK( 0 == offset % 64 );
+        CHECK( offset + 6 * sizeof( double ) == snapshot.size() );
+      } // THEN
+
+      THEN( "the table can be read again" ) {
+
+        Table read = SnapshotFormat::read( snapshot.data(),
+                                           snapshot.data() + snapshot.size() );
+        verifyHeader( read );
+        verifyChunk( read );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the table is written to and read from a file" ) {
+
+      toSnapshotFile( table, "snapshot.bin" );
+      Table read = fromSnapshotFile( "snapshot.bin" );
+
+      THEN( "the table can be read again" ) {
+
+        verifyHeader( read );
+        verifyChunk( read );
+
+        std::ostringstream original, copy;
+        table.print( original );
+        read.print( copy );
+        CHECK( original.str() == copy.str() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an ACE table with a 2.0.1 header" ) {
+
+    std::string string = chunkWith201Header();
+    State< std::string::iterator > state{ 1, string.begin(), string.end() };
+    Table table( state );
+
+    WHEN( "the table is written and read again" ) {
+
+      std::ostringstream out;
+      SnapshotFormat::write( table, out );
+      std::string snapshot = out.str();
+      Table read = SnapshotFormat::read( snapshot.data(),
+                                         snapshot.data() + snapshot.size() );
+
+      THEN( "the header is preserved" ) {
+
+        auto header = std::get< Table::Header201 >( read.header() );
+        CHECK( "2.0.1" == header.VERS() );
+        CHECK( "92238.800nc" == header.ZAID() );
+        CHECK( "ENDF/B-VIII.0" == header.SRC() );
+        CHECK_THAT( 236.0058, WithinRel( header.AWR() ) );
+        CHECK_THAT( 2.5301E-08, WithinRel( header.TEMP() ) );
+        CHECK( "2018-05-01" == header.date() );
+        CHECK( 2 == header.comments().size() );
+        verifyChunk( read );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    std::string string = chunk();
+    State< std::string::iterator > state{ 1, string.begin(), string.end() };
+    Table table( state );
+
+    std::ostringstream out;
+    SnapshotFormat::write( table, out );
+    std::string snapshot = out.str();
+
+    WHEN( "the XSS array is corrupted" ) {
+
+      snapshot[ snapshot.size() - 3 ] ^= 0x10;
+
+      THEN( "an exception is thrown unless the checksum is not verified" ) {
+
+        CHECK_THROWS( SnapshotFormat::read( snapshot.data(),
+                                            snapshot.data() + snapshot.size() ) );
+        CHECK_NOTHROW( SnapshotFormat::read( snapshot.data(),
+                                             snapshot.data() + snapshot.size(),
+                                             false ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the snapshot is truncated or not a snapshot" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( SnapshotFormat::read( snapshot.data(),
+                                            snapshot.data() + snapshot.size() - 8 ) );
+        CHECK_THROWS( SnapshotFormat::read( snapshot.data(),
+                                            snapshot.data() + 100 ) );
+        CHECK_THROWS( SnapshotFormat::read( string.data(),
+                                            string.data() + string.size() ) );
+        CHECK_THROWS( fromSnapshotFile( "not-a-file.bin" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunk() {
+
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWith201Header() {
+
+  return
+    "2.0.1                   92238.800nc            ENDF/B-VIII.0\n"
+    "  236.005800   2.5301E-08 2018-05-01          2\n"
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+void verifyHeader( const Table& table ) {
+
+  auto header = std::get< Table::Header >( table.header() );
+  CHECK( "92238.80c" == header.ZAID() );
+  CHECK_THAT( 236.0058, WithinRel( header.AWR() ) );
+  CHECK_THAT( 2.5301E-08, WithinRel( header.TEMP() ) );
+  CHECK( "12/13/12" == header.date() );
+  CHECK( "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)"
+         == header.title() );
+  CHECK( "mat9237" == header.material() );
+}
+
+void verifyChunk( const Table& table ) {
+
+  const auto& data = table.data();
+  for ( unsigned int i = 0; i < 16; ++i ) {
+
+    CHECK( static_cast< int >( i ) == data.IZ()[i] );
+    CHECK( 15. - i == data.AW()[i] );
+  }
+
+  CHECK( 6 == data.NXS(1) );
+  CHECK( 33074 == data.NXS(2) );
+  CHECK( 9 == data.NXS(16) );
+  CHECK( 1 == data.JXS(1) );
+  CHECK( 788721 == data.JXS(2) );
+  CHECK( 8 == data.JXS(32) );
+
+  CHECK( 6 == data.XSS().size() );
+  CHECK( 1.00000000000E+00 == data.XSS(1) );
+  CHECK( 1.03125000000E+00 == data.XSS(2) );
+  CHECK( 1.06250000000E+00 == data.XSS(3) );
+  CHECK( 1.09375000000E+00 == data.XSS(4) );
+  CHECK( 1.12500000000E+00 == data.XSS(5) );
+  CHECK( 1.15625000000E+00 == data.XSS(6) );
+}
@@ -2,10 +2,19 @@
 #define NJOY_ACETK_TABLE
 
 // system includes
+#include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <future>
 #include <istream>
+#include <iterator>
+#include <memory>
 #include <regex>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -14,6 +23,7 @@
 #include "tools/std20/views.hpp"
 #include "tools/disco.hpp"
 #include "ACEtk/State.hpp"
+#include "ACEtk/ThreadPool.hpp"
 
 namespace njoy {
 namespace ACEtk {
@@ -37,17 +47,22 @@ public:
 
   using HeaderVariant = std::variant< Header, Header201 >;
 
+  #include "ACEtk/Table/Summary.hpp"
+
 private:
 
   Data data_;
   HeaderVariant header_;
 
   /* auxiliary functions */
-  #include "ACEtk/Table/src/parse.hpp"
+  #include "ACEtk/Table/src/readVersion.hpp"
+  #include "ACEtk/Table/src/hasProbabilityTables.hpp"
 
 public:
 
   #include "ACEtk/Table/src/ctor.hpp"
+  #include "ACEtk/Table/src/readHeader.hpp"
+  #include "ACEtk/Table/src/skip.hpp"
 
   /**
    *  @brief Return the header information
@@ -69,6 +84,16 @@ public:
    */
   auto& data() { return this->data_; }
 
+  /**
+   *  @brief Return whether or not the table has probability tables for the URR
+   *
+   *  This is the ptable flag of the xsdir entry for the table.
+   */
+  bool ptable() const {
+
+    return hasProbabilityTables( this->header_, this->data_ );
+  }
+
   #include "ACEtk/Table/src/print.hpp"
 };
 
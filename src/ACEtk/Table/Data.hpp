@@ -10,6 +10,16 @@
  *      XSS array (the meaning of the JXS locators depend on the type of the
  *      ACE table)
  *    - the XSS array which contains the actual data
+ *
+ *  The XSS array is held in shared storage: copies of a Data object share
+ *  the same XSS array until one of them requests non-const access to it, at
+ *  which point that copy receives its own XSS array (copy on write). Non-const
+ *  access to the XSS array is therefore not thread safe when copies of the
+ *  same Data object are being used concurrently.
+ *
+ *  Once non-const access to the XSS array has been given, the caller may hold
+ *  on to a reference to it. From then on, the XSS array of the Data object is
+ *  no longer shared: copies made afterwards receive their own XSS array.
  */
 class Data {
 
@@ -18,7 +28,9 @@ class Data {
              std::array< double, 16 > > izaw_;
   std::array< int64_t, 16 > nxs_;
   std::array< int64_t, 32 > jxs_;
-  std::vector< double > xss_;
+  std::shared_ptr< const std::vector< double > > xss_;
+  bool writable_ = true;
+  bool shareable_ = true;
 
   /* type aliases */
   template< int index >
@@ -28,6 +40,8 @@ class Data {
   #include "ACEtk/Table/Data/src/name.hpp"
   #include "ACEtk/Table/Data/src/verifyIndex.hpp"
   #include "ACEtk/Table/Data/src/fetch.hpp"
+  #include "ACEtk/Table/Data/src/xss.hpp"
+  #include "ACEtk/Table/Data/src/formatXSS.hpp"
 
 protected:
 
@@ -36,6 +50,8 @@ protected:
 public:
 
   #include "ACEtk/Table/Data/src/ctor.hpp"
+  #include "ACEtk/Table/Data/src/skip.hpp"
+  #include "ACEtk/Table/Data/src/peek.hpp"
 
   /**
    *  @brief Return the IZ array
@@ -60,7 +76,7 @@ public:
   /**
    *  @brief Return the XSS array
    */
-  const std::vector< double >& XSS() const { return this->xss_; }
+  const std::vector< double >& XSS() const { return this->xss(); }
 
   /**
    *  @brief Return the IZ array
@@ -84,8 +100,28 @@ public:
 
   /**
    *  @brief Return the XSS array
+   *
+   *  If the XSS array is shared with other Data objects, a copy is made first.
+   *  The XSS array of this object is no longer shared with later copies.
    */
-  std::vector< double >& XSS() { return this->xss_; }
+  std::vector< double >& XSS() { return this->mutableXSS(); }
+
+  /**
+   *  @brief Return the shared XSS array
+   *
+   *  The shared XSS array can be used to construct other Data objects that
+   *  share the same XSS array without copying it. When non-const access to
+   *  the XSS array has been given, a copy of the XSS array is returned.
+   */
+  std::shared_ptr< const std::vector< double > > sharedXSS() const {
+
+    return this->share();
+  }
+
+  /**
+   *  @brief Return whether or not the XSS array is shared with another object
+   */
+  bool shared() const { return this->xss_.use_count() > 1; }
 
   /**
    *  @brief Return a value from the IZ array
@@ -168,11 +204,12 @@ public:
    *  @brief Return a value from the XSS array
    *
    *  Range checking is only performed when NDEBUG is not defined. When the index
-   *  is out of range, an std::out_of_range exception is thrown.
+   *  is out of range, an std::out_of_range exception is thrown. If the XSS
+   *  array is shared with other Data objects, a copy is made first.
    *
    *  @param[in] index    the index (one-based)
    */
-  double& XSS( std::size_t index ) { return fetch( this->xss_, index ); }
+  double& XSS( std::size_t index ) { return fetch( this->mutableXSS(), index ); }
 
   /**
    *  @brief Return a value from the XSS array
@@ -182,7 +219,7 @@ public:
    *
    *  @param[in] index    the index (one-based)
    */
-  double XSS( std::size_t index ) const { return fetch( this->xss_, index ); }
+  double XSS( std::size_t index ) const { return fetch( this->xss(), index ); }
 
   /**
    *  @brief Return a value from the XSS array as an integer value
@@ -194,7 +231,7 @@ public:
    */
   int IXSS( std::size_t index ) const {
 
-    return static_cast< int >( std::round( fetch( this->xss_, index ) ) );
+    return static_cast< int >( std::round( fetch( this->xss(), index ) ) );
   }
 
   #include "ACEtk/Table/Data/src/XSS.hpp"
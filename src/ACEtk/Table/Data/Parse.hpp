@@ -1,8 +1,12 @@
 struct Parse {
 
+#include "ACEtk/Table/Data/Parse/src/readXSSLine.hpp"
+#include "ACEtk/Table/Data/Parse/src/readXSSLines.hpp"
 #include "ACEtk/Table/Data/Parse/src/IZAW.hpp"
 #include "ACEtk/Table/Data/Parse/src/NXS.hpp"
 #include "ACEtk/Table/Data/Parse/src/JXS.hpp"
 #include "ACEtk/Table/Data/Parse/src/XSS.hpp"
+#include "ACEtk/Table/Data/Parse/src/skipLines.hpp"
+#include "ACEtk/Table/Data/Parse/src/skipXSS.hpp"
 
 };
@@ -17,8 +17,12 @@ XSS( State<Iterator>& state, Range& result ) {
 
     while ( remainingLines-- ) {
 
-      Line::read( state.position, state.end,
-                  iterator[0], iterator[1], iterator[2], iterator[3] );
+      // use the disco record when the fast path cannot handle the line
+      if ( not readXSSLine( state.position, state.end, iterator ) ) {
+
+        Line::read( state.position, state.end,
+                    iterator[0], iterator[1], iterator[2], iterator[3] );
+      }
       std::advance( iterator, 4 );
       ++( state.lineNumber );
       begin = state.position;
@@ -52,3 +56,87 @@ XSS( State<Iterator>& state, const std::int64_t size ) {
   XSS( state, result );
   return result;
 }
+
+/**
+ *  @brief Parse the XSS array using multiple threads
+ *
+ *  All full XSS lines have the same length (four 20 character fields and a
+ *  newline) so that the start of every line can be computed directly. The
+ *  full lines are split into contiguous chunks that are decoded concurrently
+ *  into the result. Each chunk must end exactly where the next one begins:
+ *  when that is not the case (a line with trailing characters or a missing
+ *  value) or when a chunk cannot be read, the array is parsed again
+ *  sequentially so that errors are reported with the correct line number.
+ *
+ *  @param[in,out] state     the buffer state
+ *  @param[out]    result    the XSS array (sized appropriately)
+ *  @param[in]     threads   the number of threads to use
+ */
+template< typename Iterator, typename Range >
+static void
+XSS( State<Iterator>& state, Range& result, unsigned int threads ) {
+
+  // a chunk should be large enough to make up for the thread overhead
+  constexpr std::size_t minimumLines = 4096;
+  constexpr std::size_t length = 81;
+
+  const std::size_t lines = result.size() / 4;
+  const std::size_t chunks = std::min< std::size_t >( threads, lines / minimumLines );
+
+  using Category = typename std::iterator_traits< Iterator >::iterator_category;
+  if constexpr ( std::is_base_of_v< std::random_access_iterator_tag, Category > ) {
+
+    if ( ( chunks > 1 ) &&
+         ( static_cast< std::size_t >( std::distance( state.position, state.end ) )
+           >= lines * length ) ) {
+
+      ThreadPool pool( chunks );
+      std::vector< std::future< bool > > futures;
+      futures.reserve( chunks );
+      for ( std::size_t chunk = 0; chunk < chunks; ++chunk ) {
+
+        const std::size_t first = lines * chunk / chunks;
+        const std::size_t last = lines * ( chunk + 1 ) / chunks;
+        const auto begin = std::next( state.position, first * length );
+        const auto end = std::next( state.position, last * length );
+        const auto output = std::next( result.begin(), 4 * first );
+        futures.emplace_back(
+            pool.submit( [begin, end, output, count = last - first] {
+                           return readXSSLines( begin, end, output, count ); } ) );
+      }
+
+      bool success = true;
+      for ( auto& future : futures ) {
+
+        success = future.get() && success;
+      }
+
+      if ( success ) {
+
+        // the remaining values on the last (partial) line
+        State< Iterator > remainder{ state.lineNumber + static_cast< long >( lines ),
+                                     std::next( state.position, lines * length ),
+                                     state.end };
+        std::vector< double > partial( result.size() % 4 );
+        XSS( remainder, partial );
+        std::copy( partial.begin(), partial.end(),
+                   std::next( result.begin(), 4 * lines ) );
+        state.lineNumber = remainder.lineNumber;
+        state.position = remainder.position;
+        return;
+      }
+    }
+  }
+
+  XSS( state, result );
+}
+
+template< typename Iterator >
+static auto
+XSS( State<Iterator>& state, const std::int64_t size, unsigned int threads ) {
+
+  std::vector<double> result;
+  result.resize( size );
+  XSS( state, result, threads );
+  return result;
+}
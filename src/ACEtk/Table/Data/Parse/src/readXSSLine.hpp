@@ -0,0 +1,160 @@
+/**
+ *  @brief Convert eight ASCII digits into an integer value
+ *
+ *  The eight characters are packed into a single 64-bit word and converted
+ *  using SWAR (SIMD within a register) arithmetic: all eight digits are
+ *  validated with a single mask operation and then combined pairwise in
+ *  three multiplications instead of eight.
+ *
+ *  @param[in]  digits   a pointer to the first of eight characters
+ *  @param[out] value    the resulting integer value
+ *
+ *  @return false if one of the characters is not a decimal digit
+ */
+static bool eightDigits( const char* digits, std::uint64_t& value ) {
+
+  // pack the characters in little endian order (the compiler reduces this to
+  // a single load on little endian architectures)
+  std::uint64_t chunk = 0;
+  for ( int i = 7; i >= 0; --i ) {
+
+    chunk = ( chunk << 8 ) | static_cast< unsigned char >( digits[i] );
+  }
+
+  // every byte must be in the range 0x30 to 0x39
+  if ( ( ( chunk & 0xF0F0F0F0F0F0F0F0 ) |
+         ( ( ( chunk + 0x0606060606060606 ) & 0xF0F0F0F0F0F0F0F0 ) >> 4 ) )
+       != 0x3333333333333333 ) {
+
+    return false;
+  }
+
+  chunk -= 0x3030303030303030;
+  chunk = ( chunk * 10 ) + ( chunk >> 8 );
+  chunk = ( ( ( chunk & 0x000000FF000000FF ) * 0x000F424000000064 ) +
+            ( ( ( chunk >> 16 ) & 0x000000FF000000FF ) * 0x0000271000000001 ) )
+          >> 32;
+  value = static_cast< std::uint32_t >( chunk );
+  return true;
+}
+
+/**
+ *  @brief Convert a single ASCII digit into an integer value
+ *
+ *  @param[in]  digit    the character
+ *  @param[out] value    the resulting integer value
+ *
+ *  @return false if the character is not a decimal digit
+ */
+static bool oneDigit( char digit, std::uint64_t& value ) {
+
+  value = static_cast< unsigned char >( digit - '0' );
+  return value < 10;
+}
+
+/**
+ *  @brief Read an XSS value from a well formed 20 character field
+ *
+ *  A well formed field is written as produced by Scientific< 20, 12 >, e.g.
+ *  "  1.234567890123E+00" or " -1.234567890123E-05". The 13 significant
+ *  digits always fit exactly in a double so the value is converted exactly
+ *  (and thus correctly rounded) using a single multiplication or division
+ *  by an exact power of ten.
+ *
+ *  @param[in]  field    a pointer to the first character of the field
+ *  @param[out] value    the resulting value
+ *
+ *  @return false if the field is not well formed or if its exponent does not
+ *          allow for an exact conversion
+ */
+static bool readXSSField( const char* field, double& value ) {
+
+  static constexpr double powers[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                       1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                       1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                       1e18, 1e19, 1e20, 1e21, 1e22 };
+
+  if ( ( field[0] != ' ' ) || ( ( field[1] != ' ' ) && ( field[1] != '-' ) ) ||
+       ( field[3] != '.' ) || ( field[16] != 'E' ) ||
+       ( ( field[17] != '+' ) && ( field[17] != '-' ) ) ) {
+
+    return false;
+  }
+
+  std::uint64_t leading, first, second, third, fourth, last, tens, units;
+  if ( not ( oneDigit( field[2], leading ) &&
+             eightDigits( field + 4, first ) &&
+             oneDigit( field[12], second ) && oneDigit( field[13], third ) &&
+             oneDigit( field[14], fourth ) && oneDigit( field[15], last ) &&
+             oneDigit( field[18], tens ) && oneDigit( field[19], units ) ) ) {
+
+    return false;
+  }
+
+  const std::uint64_t mantissa = leading * 1000000000000 + first * 10000 +
+                                 second * 1000 + third * 100 + fourth * 10 + last;
+  const int exponent = ( field[17] == '-' ? -1 : 1 ) *
+                       static_cast< int >( tens * 10 + units ) - 12;
+
+  if ( ( exponent < -22 ) || ( exponent > 22 ) ) {
+
+    return false;
+  }
+
+  value = exponent < 0 ? static_cast< double >( mantissa ) / powers[ -exponent ]
+                       : static_cast< double >( mantissa ) * powers[ exponent ];
+  if ( field[1] == '-' ) {
+
+    value = -value;
+  }
+  return true;
+}
+
+/**
+ *  @brief Read a full line of four XSS values (fast path)
+ *
+ *  The fast path is only taken when the line is exactly 80 characters long,
+ *  followed by a newline character and when all four fields are well formed
+ *  (see readXSSField). If that is not the case, nothing is read or advanced
+ *  and false is returned so that the caller can fall back to the regular
+ *  disco record parser.
+ *
+ *  @param[in,out] position   the current position in the buffer
+ *  @param[in]     end        the end of the buffer
+ *  @param[out]    output     an iterator to the location for the 4 values
+ *
+ *  @return true if the line was read
+ */
+template< typename Iterator, typename Output >
+static bool readXSSLine( Iterator& position, const Iterator& end,
+                         Output output ) {
+
+  using Category = typename std::iterator_traits< Iterator >::iterator_category;
+  if constexpr ( std::is_base_of_v< std::random_access_iterator_tag, Category > ) {
+
+    if ( std::distance( position, end ) < 81 ) {
+
+      return false;
+    }
+
+    char line[81];
+    std::copy_n( position, 81, line );
+    if ( line[80] != '\n' ) {
+
+      return false;
+    }
+
+    double values[4];
+    if ( readXSSField( line, values[0] ) &&
+         readXSSField( line + 20, values[1] ) &&
+         readXSSField( line + 40, values[2] ) &&
+         readXSSField( line + 60, values[3] ) ) {
+
+      std::copy( values, values + 4, output );
+      std::advance( position, 81 );
+      return true;
+    }
+  }
+
+  return false;
+}
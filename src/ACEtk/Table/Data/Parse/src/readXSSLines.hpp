@@ -0,0 +1,53 @@
+/**
+ *  @brief Read a range of full XSS lines without reporting errors
+ *
+ *  This is used to decode a chunk of the XSS array independently of the
+ *  other chunks. No errors are logged: the caller is expected to fall back
+ *  to the sequential parser (which reports the correct line number) when
+ *  the chunk could not be read.
+ *
+ *  @param[in]  position   the start of the first line in the chunk
+ *  @param[in]  end        the expected end of the last line in the chunk
+ *  @param[out] output     an iterator to the location for the values
+ *  @param[in]  lines      the number of lines in the chunk
+ *
+ *  @return true if all lines were read and the last line ended exactly at
+ *          the expected position
+ */
+template< typename Iterator, typename Output >
+static bool readXSSLines( Iterator position, const Iterator end,
+                          Output output, std::size_t lines ) {
+
+  using namespace njoy::tools::disco;
+
+  using Line = Record< Scientific< 20, 0 >,
+                       Scientific< 20, 0 >,
+                       Scientific< 20, 0 >,
+                       Scientific< 20, 0 > >;
+
+  try {
+
+    while ( lines-- ) {
+
+      if ( position == end ) {
+
+        return false;
+      }
+
+      if ( not readXSSLine( position, end, output ) ) {
+
+        Line::read( position, end,
+                    output[0], output[1], output[2], output[3] );
+      }
+      std::advance( output, 4 );
+    }
+  }
+  catch ( std::exception& ) {
+
+    return false;
+  }
+
+  // the last line must have been terminated by the newline character just
+  // before the end, otherwise the chunks are not aligned with the lines
+  return ( position == end ) && ( *std::prev( end ) == '\n' );
+}
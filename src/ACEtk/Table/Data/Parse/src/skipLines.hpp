@@ -0,0 +1,48 @@
+template< typename Iterator >
+static void
+skipLines( State<Iterator>& state, std::size_t lines, std::size_t length ) {
+
+  if ( lines == 0 ) {
+
+    return;
+  }
+
+  // when the lines have the expected length, we can jump to the end directly
+  // without reading the skipped bytes: this is verified using the line
+  // terminators of the first and last line (e.g. lines with CRLF line endings
+  // are one byte longer, so the first line does not end where expected)
+  using Category = typename std::iterator_traits< Iterator >::iterator_category;
+  if constexpr ( std::is_base_of_v< std::random_access_iterator_tag, Category > ) {
+
+    const auto bytes = lines * length;
+    if ( static_cast< std::size_t >( std::distance( state.position, state.end ) ) >= bytes ) {
+
+      auto next = std::next( state.position, bytes );
+      if ( ( *std::next( state.position, length - 1 ) == '\n' ) &&
+           ( *std::prev( next ) == '\n' ) ) {
+
+        state.position = next;
+        state.lineNumber += lines;
+        return;
+      }
+    }
+  }
+
+  // otherwise we look for the end of every line
+  while ( lines-- ) {
+
+    if ( state.position == state.end ) {
+
+      Log::error( "Encountered the end of the buffer while skipping lines on line {}",
+                  state.lineNumber );
+      throw std::exception();
+    }
+
+    state.position = std::find( state.position, state.end, '\n' );
+    if ( state.position != state.end ) {
+
+      ++state.position;
+    }
+    ++( state.lineNumber );
+  }
+}
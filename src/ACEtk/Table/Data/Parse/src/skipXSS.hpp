@@ -0,0 +1,11 @@
+template< typename Iterator >
+static void
+skipXSS( State<Iterator>& state, const std::int64_t size ) {
+
+  // full lines have 4 values of 20 characters, a partial line has 1 to 3
+  skipLines( state, size / 4, 81 );
+  if ( size % 4 ) {
+
+    skipLines( state, 1, 20 * ( size % 4 ) + 1 );
+  }
+}
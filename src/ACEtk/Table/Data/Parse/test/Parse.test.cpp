@@ -7,6 +7,7 @@ using Catch::Matchers::WithinRel;
 #include "ACEtk/Table.hpp"
 
 // other includes
+#include <cstdio>
 
 // convenience typedefs
 using namespace njoy::ACEtk;
@@ -19,6 +20,8 @@ public:
   using Parse = Table::Data::Parse;
 };
 
+std::string largeXSS( std::size_t );
+
 SCENARIO( "Data parsing functions" ) {
 
   GIVEN( "IZAW" ) {
@@ -229,6 +232,61 @@ SCENARIO( "Data parsing functions" ) {
       } // THEN
     } // WHEN
 
+    WHEN( "an XSS string with signed values and extreme exponents is parsed" ) {
+
+      std::string XSS =
+      "  1.234567890123E-11 -9.999999999999E+22  0.000000000000E+00 -0.000000000000E+00\n"
+      "  2.530000000000E-08  1.000000000000E+02 -6.022140760000E+23  1.797693134862E+08\n"
+      " 1.000000000000E-100 1.000000000000E+100  4.999999999999E-01  3.141592653590E+00\n";
+
+      State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+      auto result = Data::Parse::XSS( s, 12 );
+
+      THEN( "the data is parsed exactly" ) {
+
+        CHECK( s.lineNumber == 4 );
+        CHECK( s.position == s.end );
+
+        CHECK( 12 == result.size() );
+        CHECK( 1.234567890123E-11 == result[0] );
+        CHECK( -9.999999999999E+22 == result[1] );
+        CHECK( 0. == result[2] );
+        CHECK( 0. == result[3] );
+        CHECK( 2.53E-08 == result[4] );
+        CHECK( 1.E+02 == result[5] );
+        CHECK( -6.02214076E+23 == result[6] );
+        CHECK( 1.797693134862E+08 == result[7] );
+        CHECK_THAT( 1.E-100, WithinRel( result[8] ) );
+        CHECK_THAT( 1.E+100, WithinRel( result[9] ) );
+        CHECK( 4.999999999999E-01 == result[10] );
+        CHECK( 3.14159265359 == result[11] );
+      } // THEN
+    } // WHEN
+
+    WHEN( "an XSS string that is not in the standard format is parsed" ) {
+
+      std::string XSS =
+      "         1.000000000         1.031250000         1.062500000         1.093750000\n"
+      "  1.125000000000E+00  1.156250000000E+00  1.187500000000E+00  1.218750000000e+00\n"
+      "  1.250000000000E+00  1.281250000000E+00  1.312500000000E+00  1.343750000000E+00 \n"
+      "  1.375000000000E+00  1.406250000000E+00  1.437500000000E+00  1.468750000000E+00";
+
+      State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+      auto result = Data::Parse::XSS( s, 16 );
+
+      THEN( "the data is parsed correctly" ) {
+
+        CHECK( s.lineNumber == 5 );
+        CHECK( s.position == s.end );
+
+        CHECK( 16 == result.size() );
+        for ( unsigned int i = 0; i < 16; ++i ) {
+
+          CHECK_THAT( 1. + i * 0.03125, WithinRel( result[i] ) );
+        }
+      } // THEN
+    } // WHEN
+
     WHEN( "an incorrect XSS string is parsed" ) {
 
       std::string XSS =
@@ -239,7 +297,216 @@ SCENARIO( "Data parsing functions" ) {
 
         State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
         CHECK_THROWS( Data::Parse::XSS( s, 6 ) );
+        CHECK( s.lineNumber == 1 );
+      } // THEN
+    } // WHEN
+
+    WHEN( "an incorrect XSS string is parsed after valid lines" ) {
+
+      std::string XSS =
+      "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+      "  1.125000000000E+00  1.156250000000E+00  1.187500000000E+00  1.218750000000E+00\n"
+      "  1.250000000000E+00  1.281250000000E+00  1.3125000000dragon  1.343750000000E+00\n"
+      "  1.375000000000E+00  1.406250000000E+00\n";
+
+      THEN( "an exception is thrown and the line number is correct" ) {
+
+        State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+        CHECK_THROWS( Data::Parse::XSS( s, 14 ) );
+        CHECK( s.lineNumber == 3 );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "XSS using multiple threads" ) {
+
+    WHEN( "a large correct XSS string is parsed" ) {
+
+      std::string XSS = largeXSS( 40002 );
+
+      State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+      auto result = Data::Parse::XSS( s, 40002, 4 );
+
+      THEN( "the data is parsed correctly" ) {
+
+        CHECK( s.lineNumber == 10002 );
+        CHECK( s.position == s.end );
+
+        CHECK( 40002 == result.size() );
+        std::vector< double > expected( 40002 );
+        for ( unsigned int i = 0; i < 40002; ++i ) {
+
+          expected[i] = 1. + i * 0.125;
+        }
+        CHECK( expected == result );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a large XSS string with a line that is too long is parsed" ) {
+
+      std::string XSS = largeXSS( 40000 );
+      XSS.insert( 81 * 3000 - 1, " " );
+
+      State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+      auto result = Data::Parse::XSS( s, 40000, 4 );
+
+      THEN( "the data is parsed correctly" ) {
+
+        CHECK( s.lineNumber == 10001 );
+        CHECK( s.position == s.end );
+
+        CHECK( 40000 == result.size() );
+        std::vector< double > expected( 40000 );
+        for ( unsigned int i = 0; i < 40000; ++i ) {
+
+          expected[i] = 1. + i * 0.125;
+        }
+        CHECK( expected == result );
+      } // THEN
+    } // WHEN
+
+    WHEN( "an incorrect large XSS string is parsed" ) {
+
+      std::string XSS = largeXSS( 40000 );
+      XSS.replace( 81 * 7000 + 25, 6, "dragon" );
+
+      THEN( "an exception is thrown and the line number is correct" ) {
+
+        State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+        CHECK_THROWS( Data::Parse::XSS( s, 40000, 4 ) );
+        CHECK( s.lineNumber == 7001 );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "skipping XSS" ) {
+
+    WHEN( "a correct XSS string is skipped" ) {
+
+      std::string XSS =
+      "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+      "  1.125000000000E+00  1.156250000000E+00  1.187500000000E+00  1.218750000000E+00\n"
+      "  1.250000000000E+00  1.281250000000E+00\n"
+      "next line\n";
+
+      State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+      Data::Parse::skipXSS( s, 10 );
+
+      THEN( "the position and line number are correct" ) {
+
+        CHECK( s.lineNumber == 4 );
+        CHECK( "next line\n" == std::string( s.position, s.end ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "an XSS string that is not in the standard format is skipped" ) {
+
+      std::string XSS =
+      "         1.000000000         1.031250000         1.062500000         1.093750000\n"
+      "  1.250000000000E+00  1.281250000000E+00  1.312500000000E+00  1.343750000000E+00 \n"
+      "  1.375000000000E+00  1.406250000000E+00  1.437500000000E+00  1.468750000000E+00";
+
+      State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+      Data::Parse::skipXSS( s, 12 );
+
+      THEN( "the position and line number are correct" ) {
+
+        CHECK( s.lineNumber == 4 );
+        CHECK( s.position == s.end );
+      } // THEN
+    } // WHEN
+
+    WHEN( "an XSS string with CRLF line endings is skipped" ) {
+
+      // 82 lines of 82 characters span exactly 81 lines of 82 characters
+      std::string XSS;
+      for ( unsigned int i = 0; i < 82; ++i ) {
+
+        XSS += "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\r\n";
+      }
+      XSS += "next line\r\n";
+
+      State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+      Data::Parse::skipXSS( s, 328 );
+
+      THEN( "the position and line number are correct" ) {
+
+        CHECK( s.lineNumber == 83 );
+        CHECK( "next line\r\n" == std::string( s.position, s.end ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "an XSS string that is too short is skipped" ) {
+
+      std::string XSS =
+      "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n";
+
+      THEN( "an exception is thrown" ) {
+
+        State< std::string::iterator > s{ 1, XSS.begin(), XSS.end() };
+        CHECK_THROWS( Data::Parse::skipXSS( s, 6 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "XSS fields" ) {
+
+    WHEN( "eight digits are converted" ) {
+
+      std::uint64_t value = 0;
+
+      THEN( "the value is correct or an error is returned" ) {
+
+        CHECK( true == Data::Parse::eightDigits( "12345678", value ) );
+        CHECK( 12345678 == value );
+        CHECK( true == Data::Parse::eightDigits( "00000000", value ) );
+        CHECK( 0 == value );
+        CHECK( true == Data::Parse::eightDigits( "99999999", value ) );
+        CHECK( 99999999 == value );
+        CHECK( false == Data::Parse::eightDigits( "1234 678", value ) );
+        CHECK( false == Data::Parse::eightDigits( "1234567:", value ) );
+        CHECK( false == Data::Parse::eightDigits( "/2345678", value ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a single field is converted" ) {
+
+      double value = 0.;
+
+      THEN( "well formed fields are converted exactly" ) {
+
+        CHECK( true == Data::Parse::readXSSField( "  1.000000000000E+00", value ) );
+        CHECK( 1. == value );
+        CHECK( true == Data::Parse::readXSSField( " -2.530000000000E-08", value ) );
+        CHECK( -2.53e-8 == value );
+        CHECK( true == Data::Parse::readXSSField( "  1.999999999999E+10", value ) );
+        CHECK( 1.999999999999e+10 == value );
+      } // THEN
+
+      THEN( "other fields are left for the regular parser" ) {
+
+        CHECK( false == Data::Parse::readXSSField( "  1.000000000000E+99", value ) );
+        CHECK( false == Data::Parse::readXSSField( "  1.000000000000e+00", value ) );
+        CHECK( false == Data::Parse::readXSSField( "  1.00000000000E+000", value ) );
+        CHECK( false == Data::Parse::readXSSField( "+ 1.000000000000E+0", value ) );
+        CHECK( false == Data::Parse::readXSSField( "          1.00000000", value ) );
       } // THEN
     } // WHEN
   } // GIVEN
 } // SCENARIO
+
+std::string largeXSS( std::size_t size ) {
+
+  std::string XSS;
+  char field[21];
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    std::snprintf( field, 21, "%20.12E", 1. + i * 0.125 );
+    XSS += field;
+    if ( ( i % 4 == 3 ) || ( i + 1 == size ) ) {
+
+      XSS += '\n';
+    }
+  }
+  return XSS;
+}
@@ -3,7 +3,8 @@
  *
  *  Range checking is only performed when NDEBUG is not defined. When the index
  *  is out of range or if the array goes over its length, an std::out_of_range
- *  exception is thrown.
+ *  exception is thrown. If the XSS array is shared with other Data objects, a
+ *  copy is made first.
  *
  *  @param[in] index     the index (one-based)
  *  @param[in] length    the length of the subrange
@@ -11,10 +12,10 @@
 auto XSS( std::size_t index, std::size_t length ){
 
   #ifndef NDEBUG
-  verifyIndex( this->xss_, index );
-  verifyIndex( this->xss_, index + length - 1 );
+  verifyIndex( this->xss(), index );
+  verifyIndex( this->xss(), index + length - 1 );
   #endif
-  const auto left = std::next( this->xss_.begin(), index - 1 );
+  const auto left = std::next( this->mutableXSS().begin(), index - 1 );
   const auto right = left + length;
   return njoy::tools::std20::ranges::subrange( left, right );
 }
@@ -32,10 +33,10 @@ auto XSS( std::size_t index, std::size_t length ){
 auto XSS( std::size_t index, std::size_t length ) const {
 
   #ifndef NDEBUG
-  verifyIndex( this->xss_, index );
-  verifyIndex( this->xss_, index + length - 1 );
+  verifyIndex( this->xss(), index );
+  verifyIndex( this->xss(), index + length - 1 );
   #endif
-  const auto left = std::next( this->xss_.begin(), index - 1 );
+  const auto left = std::next( this->xss().begin(), index - 1 );
   const auto right = left + length;
   return njoy::tools::std20::ranges::subrange( left, right );
 }
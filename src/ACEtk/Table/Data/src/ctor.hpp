@@ -1,3 +1,25 @@
+Data( const Data& data ) :
+  izaw_( data.izaw_ ), nxs_( data.nxs_ ), jxs_( data.jxs_ ),
+  xss_( data.share() ), writable_( data.writable_ || not data.shareable_ ) {}
+
+Data( Data&& ) = default;
+
+Data& operator=( const Data& data ) {
+
+  if ( this != &data ) {
+
+    this->izaw_ = data.izaw_;
+    this->nxs_ = data.nxs_;
+    this->jxs_ = data.jxs_;
+    this->xss_ = data.share();
+    this->writable_ = data.writable_ || not data.shareable_;
+    this->shareable_ = true;
+  }
+  return *this;
+}
+
+Data& operator=( Data&& ) = default;
+
 /**
  *  @brief Constructor
  *
@@ -9,9 +31,10 @@
 Data( decltype(izaw_)&& izaw,
       decltype(nxs_)&& nxs,
       decltype(jxs_)&& jxs,
-      decltype(xss_)&& xss ) :
+      std::vector< double >&& xss ) :
   izaw_( std::move( izaw ) ), nxs_( std::move( nxs ) ),
-  jxs_( std::move( jxs ) ), xss_( std::move( xss ) ) {}
+  jxs_( std::move( jxs ) ),
+  xss_( std::make_shared< std::vector< double > >( std::move( xss ) ) ) {}
 
 /**
  *  @brief Constructor
@@ -26,9 +49,30 @@ Data( decltype(izaw_.first)&& iz,
       decltype(izaw_.second)&& aw,
       decltype(nxs_)&& nxs,
       decltype(jxs_)&& jxs,
-      decltype(xss_)&& xss ) :
+      std::vector< double >&& xss ) :
   izaw_( { std::move( iz ), std::move( aw ) } ), nxs_( std::move( nxs ) ),
-  jxs_( std::move( jxs ) ), xss_( std::move( xss ) ) {}
+  jxs_( std::move( jxs ) ),
+  xss_( std::make_shared< std::vector< double > >( std::move( xss ) ) ) {}
+
+/**
+ *  @brief Constructor using a shared XSS array
+ *
+ *  The XSS array is not copied. It is shared with the caller and all other
+ *  Data objects using it, and must not be modified by the caller while it
+ *  is in use (a Data object makes its own copy when non-const access to the
+ *  XSS array is requested).
+ *
+ *  @param[in] izaw   the IZAW arrays
+ *  @param[in] nxs    the NXS array
+ *  @param[in] jxs    the JXS array
+ *  @param[in] xss    the shared XSS array
+ */
+Data( decltype(izaw_)&& izaw,
+      decltype(nxs_)&& nxs,
+      decltype(jxs_)&& jxs,
+      std::shared_ptr< const std::vector< double > > xss ) :
+  izaw_( std::move( izaw ) ), nxs_( std::move( nxs ) ),
+  jxs_( std::move( jxs ) ), xss_( std::move( xss ) ), writable_( false ) {}
 
 
 private:
@@ -40,9 +84,10 @@ template< typename Iterator >
 Data( State< Iterator >& state,
       decltype(izaw_)&& izaw,
       decltype(nxs_)&& nxs,
-      decltype(jxs_)&& jxs ) :
+      decltype(jxs_)&& jxs,
+      unsigned int threads ) :
   Data( std::move( izaw ), std::move( nxs ), std::move( jxs ),
-        Parse::XSS( state, int64_t{nxs[0]} ) ){}
+        Parse::XSS( state, int64_t{nxs[0]}, threads ) ){}
 
 /**
  *  @brief Private constructor
@@ -50,16 +95,19 @@ Data( State< Iterator >& state,
 template< typename Iterator >
 Data( State< Iterator >& state,
       decltype(izaw_)&& izaw,
-      decltype(nxs_)&& nxs ) :
-  Data( state, std::move( izaw ), std::move( nxs ), Parse::JXS( state ) ){}
+      decltype(nxs_)&& nxs,
+      unsigned int threads ) :
+  Data( state, std::move( izaw ), std::move( nxs ), Parse::JXS( state ),
+        threads ){}
 
 /**
  *  @brief Private constructor
  */
 template< typename Iterator >
 Data( State< Iterator >& state,
-      decltype(izaw_)&& izaw ) :
-  Data( state, std::move( izaw ), Parse::NXS( state ) ){}
+      decltype(izaw_)&& izaw,
+      unsigned int threads ) :
+  Data( state, std::move( izaw ), Parse::NXS( state ), threads ){}
 
 public:
 
@@ -72,7 +120,28 @@ public:
  */
 template< typename Iterator >
 Data( State< Iterator >& state )
-  try : Data( state, Parse::IZAW( state ) ) {}
+  try : Data( state, Parse::IZAW( state ), 1 ) {}
+  catch( std::exception& e ) {
+
+    Log::info("Error while constructing ACE Table Data");
+    throw e;
+  }
+
+/**
+ *  @brief Constructor (from a buffer) using multiple threads
+ *
+ *  The XSS array is split into chunks of lines that are decoded
+ *  concurrently. This is only worthwhile for very large XSS arrays, smaller
+ *  arrays are read sequentially.
+ *
+ *  @tparam Iterator   a buffer iterator
+ *
+ *  @param[in] state     the buffer state
+ *  @param[in] threads   the number of threads to use for the XSS array
+ */
+template< typename Iterator >
+Data( State< Iterator >& state, unsigned int threads )
+  try : Data( state, Parse::IZAW( state ), threads ) {}
   catch( std::exception& e ) {
 
     Log::info("Error while constructing ACE Table Data");
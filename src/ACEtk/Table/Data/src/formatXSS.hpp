@@ -0,0 +1,80 @@
+/**
+ *  @brief Format an XSS value into a 20 character field
+ *
+ *  The field is identical to the one written by Scientific< 20, 12 >. Finite
+ *  values with a two digit exponent (i.e. nearly all values in an ACE table)
+ *  are converted directly into the field using std::to_chars (or snprintf
+ *  when floating point std::to_chars is not available). All other values
+ *  (non-finite values and values with a three digit exponent) are written
+ *  using Scientific< 20, 12 > itself.
+ *
+ *  @param[in]  value    the value to be formatted
+ *  @param[out] field    a pointer to the first character of the field
+ */
+static void formatXSSField( double value, char* field ) {
+
+  if ( std::isfinite( value ) ) {
+
+    // the longest two digit exponent representation is 19 characters long
+    // (e.g. -1.234567890123E+99)
+    char buffer[32];
+#ifdef __cpp_lib_to_chars
+    const auto result = std::to_chars( buffer, buffer + sizeof( buffer ), value,
+                                       std::chars_format::scientific, 12 );
+    const std::size_t size = result.ptr - buffer;
+#else
+    const std::size_t size = std::snprintf( buffer, sizeof( buffer ), "%.12E", value );
+#endif
+    if ( ( size <= 19 ) && ( buffer[ size - 4 ] == 'e' || buffer[ size - 4 ] == 'E' ) ) {
+
+      std::fill( field, field + 20 - size, ' ' );
+      std::copy( buffer, buffer + size, field + 20 - size );
+      field[ 16 ] = 'E';
+      return;
+    }
+  }
+
+  using namespace njoy::tools::disco;
+  Scientific< 20, 12 >::write( value, field );
+}
+
+/**
+ *  @brief Format XSS values into lines of four 20 character fields
+ *
+ *  Every line of four values is terminated by a newline character, as is the
+ *  final partial line (if any). The output buffer must be large enough to
+ *  hold all formatted lines (see formattedXSSSize).
+ *
+ *  @param[in]  begin     the first value to be formatted
+ *  @param[in]  end       the end of the values to be formatted
+ *  @param[out] output    a pointer to the output buffer
+ */
+template< typename Iterator >
+static void formatXSSLines( Iterator begin, Iterator end, char* output ) {
+
+  std::size_t count = 0;
+  for ( ; begin != end; ++begin ) {
+
+    formatXSSField( *begin, output );
+    output += 20;
+    if ( ++count % 4 == 0 ) {
+
+      *output++ = '\n';
+    }
+  }
+
+  if ( count % 4 ) {
+
+    *output = '\n';
+  }
+}
+
+/**
+ *  @brief Return the number of characters needed to format XSS values
+ *
+ *  @param[in] size   the number of XSS values
+ */
+static std::size_t formattedXSSSize( std::size_t size ) {
+
+  return ( size / 4 ) * 81 + ( size % 4 ? ( size % 4 ) * 20 + 1 : 0 );
+}
@@ -1,6 +1,6 @@
 /* helper functions */
 static constexpr const char*
-name( const decltype(xss_)& ){ return "XSS"; }
+name( const std::vector< double >& ){ return "XSS"; }
 
 static constexpr const char*
 name( const decltype(nxs_)& ){ return "NXS"; }
@@ -0,0 +1,30 @@
+/**
+ *  @brief Read the data arrays in a buffer without reading the XSS array
+ *
+ *  The IZAW, NXS and JXS arrays are read but the XSS array is skipped, so
+ *  the XSS array of the resulting data is empty. The state is advanced to
+ *  the end of the XSS array.
+ *
+ *  @tparam Iterator   a buffer iterator
+ *
+ *  @param[in] state   the buffer state
+ */
+template< typename Iterator >
+static Data peek( State< Iterator >& state ) {
+
+  try {
+
+    auto izaw = Parse::IZAW( state );
+    auto nxs = Parse::NXS( state );
+    auto jxs = Parse::JXS( state );
+    Parse::skipXSS( state, nxs[0] );
+
+    return Data( std::move( izaw ), std::move( nxs ), std::move( jxs ),
+                 std::vector< double >{} );
+  }
+  catch( std::exception& e ) {
+
+    Log::info( "Error while peeking at ACE Table Data" );
+    throw e;
+  }
+}
@@ -1,5 +1,15 @@
+/**
+ *  @brief Print the data arrays
+ *
+ *  The XSS array is formatted into a reusable buffer in blocks of lines. When
+ *  more than one thread is requested, the lines in each block are formatted
+ *  concurrently. The output does not depend on the number of threads.
+ *
+ *  @param[in] ostream   the output stream to write to
+ *  @param[in] threads   the number of threads to use for the XSS array
+ */
 template< typename Ostream >
-void print( Ostream& ostream ) const {
+void print( Ostream& ostream, unsigned int threads ) const {
 
   using namespace njoy::tools::disco;
 
@@ -57,28 +67,66 @@ void print( Ostream& ostream ) const {
                   this->JXS(25), this->JXS(26), this->JXS(27), this->JXS(28),
                   this->JXS(29), this->JXS(30), this->JXS(31), this->JXS(32) );
 
-  auto remainingLines = this->XSS().size() / 4;
-  auto remainingEntries = this->XSS().size() % 4;
-  auto iterator = this->XSS().begin();
+  // blocks of 16384 lines (about 1.3 MB) are formatted at a time and each
+  // thread formats a slice of at least 1024 lines
+  constexpr std::size_t blockLines = 16384;
+  constexpr std::size_t minimumLines = 1024;
 
-  using XSSLine = Record< Scientific< 20, 12 >,
-                          Scientific< 20, 12 >,
-                          Scientific< 20, 12 >,
-                          Scientific< 20, 12 > >;
+  const auto& xss = this->XSS();
+  const std::size_t lines = ( xss.size() + 3 ) / 4;
+  const std::size_t slices = std::max< std::size_t >(
+                                 1, std::min< std::size_t >( threads,
+                                                             blockLines / minimumLines ) );
 
-  while ( remainingLines-- ) {
+  std::unique_ptr< ThreadPool > pool;
+  if ( ( slices > 1 ) && ( lines > minimumLines ) ) {
 
-    XSSLine::write( it, iterator[0], iterator[1], iterator[2], iterator[3] );
-    std::advance( iterator, 4 );
+    pool = std::make_unique< ThreadPool >( slices );
   }
 
-  if ( remainingEntries ) {
+  std::vector< char > buffer( formattedXSSSize( std::min( lines, blockLines ) * 4 ) );
+  for ( std::size_t line = 0; line < lines; line += blockLines ) {
+
+    const auto begin = xss.begin() + line * 4;
+    const auto end = xss.begin() + std::min( xss.size(), ( line + blockLines ) * 4 );
+    const std::size_t size = std::distance( begin, end );
+
+    if ( pool ) {
+
+      // slices are formatted into disjoint parts of the buffer
+      const std::size_t sliceLines = ( ( size + 3 ) / 4 + slices - 1 ) / slices;
+      std::vector< std::future< void > > futures;
+      for ( std::size_t first = 0; first < size; first += sliceLines * 4 ) {
 
-    while( remainingEntries-- ) {
+        const std::size_t last = std::min( size, first + sliceLines * 4 );
+        char* output = buffer.data() + ( first / 4 ) * 81;
+        futures.emplace_back(
+            pool->submit( [begin, first, last, output] {
+
+              formatXSSLines( begin + first, begin + last, output );
+            } ) );
+      }
+      for ( auto& future : futures ) {
+
+        future.get();
+      }
+    }
+    else {
 
-      Scientific< 20, 12 >::write( *iterator, it );
-      ++iterator;
+      formatXSSLines( begin, end, buffer.data() );
     }
-    Record<>::write( it );
+
+    ostream.write( buffer.data(), formattedXSSSize( size ) );
   }
 }
+
+/**
+ *  @brief Print the data arrays
+ *
+ *  @param[in] ostream   the output stream to write to
+ */
+template< typename Ostream >
+void print( Ostream& ostream ) const {
+
+  this->print( ostream, 1 );
+}
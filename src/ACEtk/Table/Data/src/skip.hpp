@@ -0,0 +1,26 @@
+/**
+ *  @brief Skip over the data arrays in a buffer without reading the XSS array
+ *
+ *  Only the NXS array is read to determine the length of the XSS array. The
+ *  state is advanced to the end of the XSS array.
+ *
+ *  @tparam Iterator   a buffer iterator
+ *
+ *  @param[in] state   the buffer state
+ */
+template< typename Iterator >
+static void skip( State< Iterator >& state ) {
+
+  try {
+
+    Parse::skipLines( state, 4, 73 );
+    const auto nxs = Parse::NXS( state );
+    Parse::skipLines( state, 4, 73 );
+    Parse::skipXSS( state, nxs[0] );
+  }
+  catch( std::exception& e ) {
+
+    Log::info( "Error while skipping ACE Table Data" );
+    throw e;
+  }
+}
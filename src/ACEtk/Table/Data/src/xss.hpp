@@ -0,0 +1,31 @@
+const std::vector< double >& xss() const {
+
+  // a moved from object has no XSS array
+  static const std::vector< double > empty;
+  return this->xss_ ? *this->xss_ : empty;
+}
+
+std::vector< double >& mutableXSS() {
+
+  // copy on write: the XSS array can only be modified in place when it was
+  // created by a Data object and when it is not shared
+  if ( ( not this->writable_ ) || ( this->xss_.use_count() != 1 ) ) {
+
+    this->xss_ = std::make_shared< std::vector< double > >( this->xss() );
+    this->writable_ = true;
+  }
+
+  // a reference to the XSS array may now be kept by the caller
+  this->shareable_ = false;
+  return const_cast< std::vector< double >& >( *this->xss_ );
+}
+
+std::shared_ptr< const std::vector< double > > share() const {
+
+  // an XSS array to which a non-const reference was given is copied
+  if ( this->shareable_ || ( not this->xss_ ) ) {
+
+    return this->xss_;
+  }
+  return std::make_shared< std::vector< double > >( *this->xss_ );
+}
@@ -7,6 +7,8 @@ using Catch::Matchers::WithinRel;
 #include "ACEtk/Table.hpp"
 
 // other includes
+#include <cmath>
+#include <limits>
 
 // convenience typedefs
 using namespace njoy::ACEtk;
@@ -118,6 +120,164 @@ SCENARIO( "Data" ) {
         CHECK( oss.str() == string );
       } // THEN
     } // WHEN
+
+    WHEN( "the data is read from a string/stream using multiple threads" ) {
+
+      State< std::string::iterator > state{ 1, string.begin(), string.end() };
+      Data chunk( state, 4 );
+
+      THEN( "a Data can be constructed and members can be tested" ) {
+
+        verifyChunk( chunk );
+        CHECK( state.position == state.end );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a Data instance read from a string/stream" ) {
+
+    std::string string = chunk();
+    State< std::string::iterator > state{ 1, string.begin(), string.end() };
+    Data chunk( state );
+
+    WHEN( "the Data instance is copied" ) {
+
+      Data copy( chunk );
+
+      THEN( "the XSS array is shared" ) {
+
+        CHECK( true == chunk.shared() );
+        CHECK( true == copy.shared() );
+        CHECK( chunk.sharedXSS() == copy.sharedXSS() );
+        verifyChunk( copy );
+      } // THEN
+
+      THEN( "the XSS array is copied when it is modified" ) {
+
+        copy.XSS( 1 ) = 2.;
+
+        CHECK( false == chunk.shared() );
+        CHECK( false == copy.shared() );
+        CHECK( chunk.sharedXSS() != copy.sharedXSS() );
+        CHECK( 2. == copy.XSS( 1 ) );
+        verifyChunk( chunk );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the XSS array is modified when it is not shared" ) {
+
+      const double* address = chunk.XSS().data();
+      chunk.XSS()[0] = 2.;
+
+      THEN( "the XSS array is modified in place" ) {
+
+        CHECK( false == chunk.shared() );
+        CHECK( address == chunk.XSS().data() );
+        CHECK( 2. == chunk.XSS( 1 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the Data instance is copied after a reference to the XSS array was given" ) {
+
+      auto& xss = chunk.XSS();
+      Data copy = chunk;
+      Data assigned( copy );
+      assigned = chunk;
+      xss[0] = 42.;
+
+      THEN( "the copies have their own XSS array" ) {
+
+        CHECK( false == chunk.shared() );
+        CHECK( false == copy.shared() );
+        CHECK( false == assigned.shared() );
+        CHECK( 42. == chunk.XSS( 1 ) );
+        verifyChunk( copy );
+        verifyChunk( assigned );
+      } // THEN
+
+      THEN( "the shared XSS array is a copy" ) {
+
+        auto shared = chunk.sharedXSS();
+        xss[0] = 43.;
+
+        CHECK( 42. == shared->front() );
+        CHECK( 43. == chunk.XSS( 1 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a Data instance is constructed using a shared XSS array" ) {
+
+      auto xss = chunk.sharedXSS();
+      Data shared( { chunk.IZ(), chunk.AW() }, std::array< int64_t, 16 >( chunk.NXS() ),
+                   std::array< int64_t, 32 >( chunk.JXS() ), xss );
+
+      THEN( "the XSS array is not copied" ) {
+
+        CHECK( xss == shared.sharedXSS() );
+        verifyChunk( shared );
+      } // THEN
+
+      THEN( "the XSS array is copied when it is modified" ) {
+
+        xss = nullptr;
+        shared.XSS( 1 ) = 2.;
+
+        CHECK( chunk.sharedXSS() != shared.sharedXSS() );
+        CHECK( 2. == shared.XSS( 1 ) );
+        verifyChunk( chunk );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a Data instance with a large XSS array" ) {
+
+    // values covering all formatting cases (including values that use
+    // a three digit exponent and non-finite values)
+    std::vector< double > values = {
+        0., -0., 1., -1., 0.1, 1.0000000000005, 9.9999999999995, 123456789.123456789,
+        -2.5301E-08, 1e-99, 1e-100, -1e-300, 1e99, 1e100, 1.7976931348623157e308,
+        4.9406564584124654e-324, 2.2250738585072014e-308, 1. / 3., -2. / 3.,
+        std::numeric_limits< double >::infinity(),
+        -std::numeric_limits< double >::infinity(),
+        std::numeric_limits< double >::quiet_NaN() };
+    std::vector< double > xss;
+    for ( unsigned int i = 0; i < 100003; ++i ) {
+
+      xss.push_back( i < values.size() ? values[i]
+                                       : std::sin( i ) * std::pow( 10., i % 61 - 30 ) );
+    }
+
+    Data chunk( {}, {}, {}, {}, std::vector< double >( xss ) );
+
+    WHEN( "the data is printed" ) {
+
+      std::ostringstream sequential;
+      std::ostringstream concurrent;
+      chunk.print( sequential );
+      chunk.print( concurrent, 4 );
+
+      THEN( "the XSS array is formatted as Scientific< 20, 12 >" ) {
+
+        using namespace njoy::tools::disco;
+
+        std::string expected;
+        auto it = std::back_inserter( expected );
+        std::size_t count = 0;
+        for ( auto value : xss ) {
+
+          Scientific< 20, 12 >::write( value, it );
+          if ( ++count % 4 == 0 ) {
+
+            Record<>::write( it );
+          }
+        }
+        Record<>::write( it );
+
+        std::string string = sequential.str();
+        CHECK( expected == string.substr( string.size() - expected.size() ) );
+        CHECK( sequential.str() == concurrent.str() );
+      } // THEN
+    } // WHEN
   } // GIVEN
 } // SCENARIO
 
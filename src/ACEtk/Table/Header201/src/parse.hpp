@@ -34,6 +34,7 @@ Header201 parse( State< Iterator >& state ) {
 
   std::string line;
   Line::read( state.position, state.end, line );
+  ++state.lineNumber;
   std::istringstream input( line );
   input >> awr >> temp >> date >> number;
 
@@ -60,6 +61,7 @@ Header201 parse( State< Iterator >& state ) {
   for ( unsigned int i = 0; i < static_cast< unsigned int >( number ); ++i ) {
 
     Line::read( state.position, state.end, line );
+    ++state.lineNumber;
     auto back = std::find_if( line.rbegin(), line.rend(), notspace );
     line.erase( back.base(), line.end() );
     comments.push_back( line );
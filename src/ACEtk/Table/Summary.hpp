@@ -0,0 +1,94 @@
+/**
+ *  @class
+ *  @brief A summary of an ACE table
+ *
+ *  The summary of an ACE table contains the header of the table and its
+ *  IZAW, NXS and JXS arrays. The XSS array is skipped without being read so
+ *  a summary can be used to quickly scan the tables in a library (e.g. to
+ *  produce an inventory or an xsdir file).
+ */
+class Summary {
+
+  /* fields */
+  long lineNumber_;
+  HeaderVariant header_;
+  Data data_;
+
+public:
+
+  #include "ACEtk/Table/Summary/src/ctor.hpp"
+
+  /**
+   *  @brief Return the line number on which the table starts
+   *
+   *  For a type 1 ACE file, this is the address of the table in an xsdir file.
+   */
+  long lineNumber() const { return this->lineNumber_; }
+
+  /**
+   *  @brief Return the header information
+   */
+  const HeaderVariant& header() const { return this->header_; }
+
+  /**
+   *  @brief Return the data arrays
+   *
+   *  The XSS array of the data is not read and is therefore empty.
+   */
+  const Data& data() const { return this->data_; }
+
+  /**
+   *  @brief Return the full ZAID or SZAID of the table
+   */
+  const std::string& ZAID() const {
+
+    return std::visit( [] ( const auto& header ) -> decltype(auto)
+                          { return header.ZAID(); },
+                       this->header() );
+  }
+
+  /**
+   *  @brief Return the atomic weight ratio
+   */
+  double AWR() const {
+
+    return std::visit( [] ( const auto& header ) -> decltype(auto)
+                          { return header.AWR(); },
+                       this->header() );
+  }
+
+  /**
+   *  @brief Return the temperature of the table
+   */
+  double TEMP() const {
+
+    return std::visit( [] ( const auto& header ) -> decltype(auto)
+                          { return header.TEMP(); },
+                       this->header() );
+  }
+
+  /**
+   *  @brief Return the date
+   */
+  const std::string& date() const {
+
+    return std::visit( [] ( const auto& header ) -> decltype(auto)
+                          { return header.date(); },
+                       this->header() );
+  }
+
+  /**
+   *  @brief Return the length of the XSS array
+   */
+  std::size_t length() const { return this->data().NXS(1); }
+
+  /**
+   *  @brief Return whether or not the table has probability tables for the URR
+   *
+   *  This is the ptable flag of the xsdir entry for the table.
+   */
+  bool ptable() const {
+
+    return hasProbabilityTables( this->header_, this->data_ );
+  }
+};
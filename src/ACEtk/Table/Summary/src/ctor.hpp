@@ -0,0 +1,30 @@
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] lineNumber   the line number on which the table starts
+ *  @param[in] header       the header information
+ *  @param[in] data         the data arrays (without the XSS array)
+ */
+Summary( long lineNumber, HeaderVariant&& header, Data&& data ) :
+  lineNumber_( lineNumber ), header_( std::move( header ) ),
+  data_( std::move( data ) ) {}
+
+/**
+ *  @brief Constructor (from a buffer)
+ *
+ *  The header, IZAW, NXS and JXS arrays are read and the XSS array is
+ *  skipped. The state is advanced to the start of the next table.
+ *
+ *  @tparam Iterator   a buffer iterator
+ *
+ *  @param[in] state   the buffer state
+ */
+template< typename Iterator >
+Summary( State< Iterator >& state )
+  try : lineNumber_( state.lineNumber ), header_( readHeader( state ) ),
+        data_( Data::peek( state ) ) {}
+  catch( std::exception& e ) {
+
+    Log::info( "Error while constructing an ACE Table summary" );
+    throw e;
+  }
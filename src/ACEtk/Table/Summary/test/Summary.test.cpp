@@ -0,0 +1,227 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/Table.hpp"
+#include "ACEtk/peekHeader.hpp"
+
+// other includes
+#include <fstream>
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+using Summary = Table::Summary;
+
+std::string chunk();
+std::string chunkWith201Header();
+std::string chunkWithUnreadableXSS();
+void verifyChunk( const Summary& );
+
+SCENARIO( "Summary" ) {
+
+  GIVEN( "valid data for a concatenated file" ) {
+
+    std::string string = chunk() + chunkWith201Header();
+
+    WHEN( "the summaries are read from a buffer" ) {
+
+      auto begin = string.begin();
+      auto end = string.end();
+      State< std::string::iterator > state{ 1, begin, end };
+
+      Summary first( state );
+      auto position = state.position;
+      Summary second( state );
+
+      THEN( "the header and arrays are read and the XSS array is skipped" ) {
+
+        CHECK( 1 == first.lineNumber() );
+        CHECK( true == std::holds_alternative< Table::Header >( first.header() ) );
+        CHECK( "92238.80c" == first.ZAID() );
+        CHECK( "12/13/12" == first.date() );
+        verifyChunk( first );
+
+        CHECK( 15 == second.lineNumber() );
+        CHECK( true == std::holds_alternative< Table::Header201 >( second.header() ) );
+        CHECK( "92238.800nc" == second.ZAID() );
+        CHECK( "2018-05-01" == second.date() );
+        verifyChunk( second );
+
+        CHECK( chunk().size() == std::distance( begin, position ) );
+        CHECK( state.end == state.position );
+        CHECK( 31 == state.lineNumber );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the summaries are read from a file" ) {
+
+      {
+        std::ofstream out( "concatenated.ace", std::ios::binary );
+        out << string;
+      }
+
+      Summary first = peekHeader( "concatenated.ace" );
+      std::vector< Summary > summaries = peekConcatenatedFile( "concatenated.ace" );
+
+      THEN( "the summaries are read correctly" ) {
+
+        CHECK( 1 == first.lineNumber() );
+        verifyChunk( first );
+
+        CHECK( 2 == summaries.size() );
+        CHECK( 1 == summaries[0].lineNumber() );
+        CHECK( 15 == summaries[1].lineNumber() );
+        verifyChunk( summaries[0] );
+        verifyChunk( summaries[1] );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a concatenated file with XSS lines that cannot be read" ) {
+
+    std::string string = chunkWithUnreadableXSS() + chunkWith201Header();
+    {
+      std::ofstream out( "unreadable.ace", std::ios::binary );
+      out << string;
+    }
+
+    WHEN( "the summaries are read" ) {
+
+      auto begin = string.begin();
+      auto end = string.end();
+      State< std::string::iterator > state{ 1, begin, end };
+
+      Summary first( state );
+      auto position = state.position;
+      Summary second( state );
+      std::vector< Summary > summaries = peekConcatenatedFile( "unreadable.ace" );
+
+      THEN( "the XSS array is skipped without reading its lines" ) {
+
+        CHECK( 1 == first.lineNumber() );
+        CHECK( 400 == first.length() );
+        CHECK( chunkWithUnreadableXSS().size() == std::distance( begin, position ) );
+
+        CHECK( 113 == second.lineNumber() );
+        CHECK( "92238.800nc" == second.ZAID() );
+        verifyChunk( second );
+        CHECK( state.end == state.position );
+
+        CHECK( 2 == summaries.size() );
+        CHECK( 113 == summaries[1].lineNumber() );
+        verifyChunk( summaries[1] );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    WHEN( "the XSS array is shorter than indicated in the NXS array" ) {
+
+      std::string string = chunk();
+      string.erase( string.size() - 42 );
+
+      auto begin = string.begin();
+      auto end = string.end();
+      State< std::string::iterator > state{ 1, begin, end };
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( Summary( state ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the file does not exist" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( peekHeader( "not-a-file.ace" ) );
+        CHECK_THROWS( peekConcatenatedFile( "not-a-file.ace" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunk() {
+
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWithUnreadableXSS() {
+
+  // an XSS array of 100 lines of which only the first and last line are
+  // valid, the others are not numbers and have no line endings
+  std::string xss = "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n";
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "      400    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    + xss + std::string( 98 * xss.size(), '#' ) + xss;
+}
+
+std::string chunkWith201Header() {
+
+  return
+    "2.0.1                   92238.800nc            ENDF/B-VIII.0\n"
+    "  236.005800   2.5301E-08 2018-05-01          2\n"
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+void verifyChunk( const Summary& chunk ) {
+
+  CHECK_THAT( 236.0058, WithinRel( chunk.AWR() ) );
+  CHECK_THAT( 2.5301E-08, WithinRel( chunk.TEMP() ) );
+  CHECK( 6 == chunk.length() );
+  CHECK( true == chunk.ptable() );
+
+  CHECK( 0 == chunk.data().IZ(1) );
+  CHECK( 15 == chunk.data().IZ(16) );
+  CHECK_THAT( 15., WithinRel( chunk.data().AW(1) ) );
+  CHECK_THAT( 0., WithinRel( chunk.data().AW(16) ) );
+
+  CHECK( 6 == chunk.data().NXS(1) );
+  CHECK( 33074 == chunk.data().NXS(2) );
+  CHECK( 9 == chunk.data().NXS(16) );
+  CHECK( 1 == chunk.data().JXS(1) );
+  CHECK( 8 == chunk.data().JXS(32) );
+
+  CHECK( 0 == chunk.data().XSS().size() );
+}
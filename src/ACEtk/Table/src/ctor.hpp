@@ -16,6 +16,13 @@ template< typename Iterator >
 Table( HeaderVariant&& header, State< Iterator >& state ) :
   Table( std::move( header ), Data( state ) ){}
 
+/**
+ *  @brief Private constructor
+ */
+template< typename Iterator >
+Table( HeaderVariant&& header, State< Iterator >& state, unsigned int threads ) :
+  Table( std::move( header ), Data( state, threads ) ){}
+
 public:
 
 Table( const Table& ) = default;
@@ -33,7 +40,7 @@ Table& operator=( Table&& ) = default;
  */
 template< typename Iterator >
 Table( State< Iterator >& state )
-  try: Table( parse( state ), state ) {}
+  try: Table( readHeader( state ), state ) {}
   catch( std::exception& e ) {
 
     Log::info("Error while constructing ACE Table");
@@ -49,3 +56,23 @@ Table( State< Iterator >& state )
  */
 template< typename Iterator >
 Table( State< Iterator >&& state ) : Table( state ) {}
+
+/**
+ *  @brief Constructor (from a buffer) using multiple threads
+ *
+ *  The XSS array of the table is decoded concurrently when it is large
+ *  enough to benefit from it.
+ *
+ *  @tparam Iterator   a buffer iterator
+ *
+ *  @param[in] state     the buffer state
+ *  @param[in] threads   the number of threads to use for the XSS array
+ */
+template< typename Iterator >
+Table( State< Iterator >& state, unsigned int threads )
+  try: Table( readHeader( state ), state, threads ) {}
+  catch( std::exception& e ) {
+
+    Log::info("Error while constructing ACE Table");
+    throw e;
+  }
@@ -0,0 +1,19 @@
+/**
+ *  @brief Return whether or not a table has probability tables for the URR
+ *
+ *  Only continuous energy tables (with a ZAID ending in c, h, o, r, s or a)
+ *  can have an UNR block, which is present when JXS(23) is not zero.
+ *
+ *  @param[in] header   the header of the table
+ *  @param[in] data     the data of the table
+ */
+static bool hasProbabilityTables( const HeaderVariant& header, const Data& data ) {
+
+  const std::string& zaid = std::visit( [] ( const auto& header ) -> decltype(auto)
+                                           { return header.ZAID(); },
+                                        header );
+  const char type = zaid.empty() ? ' ' : zaid.back();
+  const bool continuous = ( type == 'c' ) || ( type == 'h' ) || ( type == 'o' ) ||
+                          ( type == 'r' ) || ( type == 's' ) || ( type == 'a' );
+  return continuous && ( data.JXS( 23 ) != 0 );
+}
@@ -10,3 +10,19 @@ void print( Ostream& ostream ) const {
               this->header_ );
   this->data_.print( ostream );
 }
+
+/**
+ *  @brief Print the table using multiple threads to format the XSS array
+ *
+ *  The output is identical to the output of the single threaded print.
+ *
+ *  @param[in] ostream   the output stream to write to
+ *  @param[in] threads   the number of threads to use
+ */
+template< typename Ostream >
+void print( Ostream& ostream, unsigned int threads ) const {
+
+  std::visit( [&ostream] ( const auto& header ) { header.print( ostream ); },
+              this->header_ );
+  this->data_.print( ostream, threads );
+}
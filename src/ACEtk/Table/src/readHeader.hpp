@@ -0,0 +1,23 @@
+/**
+ *  @brief Read the header of an ACE table (a legacy or a 2.0.x header)
+ *
+ *  The header type is determined using the version on the first line. This
+ *  can be used to read the header text stored in the binary formats.
+ *
+ *  @tparam Iterator   a buffer iterator
+ *
+ *  @param[in] state   the buffer state
+ */
+template< typename Iterator >
+static HeaderVariant readHeader( State< Iterator >& state ) {
+
+  std::string version = readVersion( state );
+  if ( ( version == "2.0.0" ) || ( version == "2.0.1" ) ) {
+
+    return Header201( state );
+  }
+  else{
+
+    return Header( state );
+  }
+}
@@ -16,17 +16,3 @@ static std::string readVersion( State< Iterator >& state ) {
   input >> version;
   return version;
 }
-
-template< typename Iterator >
-static HeaderVariant parse( State< Iterator >& state ) {
-
-  std::string version = readVersion( state );
-  if ( ( version == "2.0.0" ) || ( version == "2.0.1" ) ) {
-
-    return Header201( state );
-  }
-  else{
-
-    return Header( state );
-  }
-}
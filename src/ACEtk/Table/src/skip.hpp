@@ -0,0 +1,24 @@
+/**
+ *  @brief Skip over a table in a buffer without reading the XSS array
+ *
+ *  This can be used to quickly find the boundaries of the tables in a
+ *  concatenated file. The state is advanced to the start of the next table.
+ *
+ *  @tparam Iterator   a buffer iterator
+ *
+ *  @param[in] state   the buffer state
+ */
+template< typename Iterator >
+static void skip( State< Iterator >& state ) {
+
+  try {
+
+    readHeader( state );
+    Data::skip( state );
+  }
+  catch( std::exception& e ) {
+
+    Log::info( "Error while skipping ACE Table" );
+    throw e;
+  }
+}
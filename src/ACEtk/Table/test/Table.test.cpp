@@ -5,6 +5,7 @@ using Catch::Matchers::WithinRel;
 
 // what we are testing
 #include "ACEtk/Table.hpp"
+#include "ACEtk/fromFile.hpp"
 
 // other includes
 
@@ -155,6 +156,74 @@ SCENARIO( "Table" ) {
       } // THEN
     } // WHEN
   } // GIVEN
+
+  GIVEN( "valid data for concatenated tables" ) {
+
+    std::string string = chunk() + chunkWith201Header() +
+                         chunkWith200Header() + chunk();
+
+    WHEN( "the tables are skipped" ) {
+
+      State< std::string::iterator > state{ 1, string.begin(), string.end() };
+
+      THEN( "the boundaries are the same as when reading the tables" ) {
+
+        State< std::string::iterator > read{ 1, string.begin(), string.end() };
+        for ( unsigned int i = 0; i < 4; ++i ) {
+
+          Table::skip( state );
+          Table table( read );
+          CHECK( read.lineNumber == state.lineNumber );
+          CHECK( read.position == state.position );
+        }
+        CHECK( state.position == state.end );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the tables are read concurrently" ) {
+
+      State< std::string::iterator > state{ 1, string.begin(), string.end() };
+      std::vector< Table > tables = readTables( state, 3 );
+
+      THEN( "the tables are read in order" ) {
+
+        CHECK( 4 == tables.size() );
+        verifyHeader( tables[0] );
+        verifyChunk( tables[0] );
+        verifyHeader201( tables[1] );
+        verifyChunk( tables[1] );
+        CHECK( "2.0.0" == std::get< Header201 >( tables[2].header() ).VERS() );
+        verifyChunk( tables[2] );
+        verifyHeader( tables[3] );
+        verifyChunk( tables[3] );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data for concatenated tables" ) {
+
+    std::string string = chunk() + chunk();
+    string.erase( string.size() - 41 );
+
+    WHEN( "the tables are skipped" ) {
+
+      THEN( "an exception is thrown for the truncated table" ) {
+
+        State< std::string::iterator > state{ 1, string.begin(), string.end() };
+        CHECK_NOTHROW( Table::skip( state ) );
+        CHECK_THROWS( Table::skip( state ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the tables are read concurrently" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        State< std::string::iterator > state{ 1, string.begin(), string.end() };
+        CHECK_THROWS( readTables( state, 2 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
 } // SCENARIO
 
 std::string chunk() {
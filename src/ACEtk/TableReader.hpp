@@ -0,0 +1,79 @@
+#ifndef NJOY_ACETK_TABLEREADER
+#define NJOY_ACETK_TABLEREADER
+
+// system includes
+#include <cstddef>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/State.hpp"
+#include "ACEtk/Table.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A streaming reader for concatenated ACE files
+ *
+ *  The TableReader class reads the ACE tables in an input stream one at a
+ *  time. Only the lines of the current table are kept in a window buffer
+ *  that is reused for every table, so the memory required to go over a
+ *  concatenated file is proportional to the size of the largest table
+ *  instead of the size of the file.
+ *
+ *  The tables can be retrieved using next() or by iterating over the reader
+ *  (which is a single pass input range):
+ *
+ *    TableReader reader( "library.ace" );
+ *    for ( const Table& table : reader ) { ... }
+ */
+class TableReader {
+
+  /* fields */
+  std::unique_ptr< std::ifstream > file_;
+  std::istream* in_;
+  std::string buffer_;
+  std::string line_;
+  long lineNumber_ = 1;
+
+  /* auxiliary functions */
+  #include "ACEtk/TableReader/src/readLine.hpp"
+  #include "ACEtk/TableReader/src/readLines.hpp"
+
+public:
+
+  #include "ACEtk/TableReader/Iterator.hpp"
+
+  /* constructor */
+  #include "ACEtk/TableReader/src/ctor.hpp"
+
+  /**
+   *  @brief Return the line number on which the next table starts
+   */
+  long lineNumber() const { return this->lineNumber_; }
+
+  #include "ACEtk/TableReader/src/next.hpp"
+
+  /**
+   *  @brief Return an iterator to the next table in the stream
+   */
+  Iterator begin() { return Iterator( *this ); }
+
+  /**
+   *  @brief Return the end iterator
+   */
+  Iterator end() { return Iterator(); }
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
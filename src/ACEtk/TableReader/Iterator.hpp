@@ -0,0 +1,63 @@
+/**
+ *  @class
+ *  @brief A single pass input iterator over the tables of a TableReader
+ *
+ *  Incrementing the iterator reads the next table from the stream, after
+ *  which the previous table is no longer available through the iterator.
+ */
+class Iterator {
+
+  /* fields */
+  TableReader* reader_ = nullptr;
+  std::optional< Table > table_;
+
+public:
+
+  using iterator_category = std::input_iterator_tag;
+  using value_type = Table;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Table*;
+  using reference = const Table&;
+
+  /**
+   *  @brief Default constructor (the end iterator)
+   */
+  Iterator() = default;
+
+  /**
+   *  @brief Constructor
+   *
+   *  @param[in] reader   the reader to read the tables from
+   */
+  explicit Iterator( TableReader& reader ) :
+    reader_( &reader ), table_( reader.next() ) {}
+
+  reference operator*() const { return *this->table_; }
+  pointer operator->() const { return &*this->table_; }
+
+  Iterator& operator++() {
+
+    this->table_ = this->reader_->next();
+    return *this;
+  }
+
+  void operator++( int ) { ++*this; }
+
+  /**
+   *  @brief Take the current table out of the iterator
+   *
+   *  This avoids copying the table when it needs to be kept.
+   */
+  Table take() { return std::move( *this->table_ ); }
+
+  friend bool operator==( const Iterator& left, const Iterator& right ) {
+
+    return left.table_.has_value() == right.table_.has_value() &&
+           ( not left.table_.has_value() || left.reader_ == right.reader_ );
+  }
+
+  friend bool operator!=( const Iterator& left, const Iterator& right ) {
+
+    return not ( left == right );
+  }
+};
@@ -0,0 +1,30 @@
+TableReader( const TableReader& ) = delete;
+TableReader( TableReader&& ) = default;
+TableReader& operator=( const TableReader& ) = delete;
+TableReader& operator=( TableReader&& ) = default;
+
+/**
+ *  @brief Constructor
+ *
+ *  The stream must remain valid for as long as the reader is used.
+ *
+ *  @param[in] in   the input stream
+ */
+TableReader( std::istream& in ) : in_( &in ) {}
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] filename   the file name
+ */
+TableReader( const std::string& filename ) :
+  file_( std::make_unique< std::ifstream >( filename,
+                                            std::ios::in | std::ios::binary ) ),
+  in_( file_.get() ) {
+
+  if ( not *this->file_ ) {
+
+    Log::error( "Could not open file \'{}\'", filename );
+    throw std::exception();
+  }
+}
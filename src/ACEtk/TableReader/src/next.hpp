@@ -0,0 +1,75 @@
+/**
+ *  @brief Read the next table in the stream
+ *
+ *  The lines of the table are determined using the header and the NXS array
+ *  (the XSS array is read line by line using its length in NXS(1)) and the
+ *  table is then parsed from the buffer. The buffer is reused for every
+ *  table.
+ *
+ *  @return the next table or std::nullopt when the end of the stream was
+ *          reached
+ */
+std::optional< Table > next() {
+
+  this->buffer_.clear();
+  if ( not this->readLine() ) {
+
+    return std::nullopt;
+  }
+  std::size_t lines = 1;
+
+  // the header: 2 lines or 2 lines followed by a number of comment lines
+  std::string version;
+  std::istringstream( this->line_ ) >> version;
+  this->readLines( 1 );
+  ++lines;
+  if ( ( version == "2.0.0" ) || ( version == "2.0.1" ) ) {
+
+    double awr = 0.;
+    double temp = 0.;
+    std::string date;
+    long comments = -1;
+    std::istringstream( this->line_ ) >> awr >> temp >> date >> comments;
+    if ( comments < 0 ) {
+
+      Log::error( "Could not read the number of comment lines in the header" );
+      Log::info( "The table starts on line {}", this->lineNumber_ );
+      throw std::exception();
+    }
+    this->readLines( comments );
+    lines += comments;
+  }
+
+  // the IZAW array and the first NXS line (which contains the XSS length)
+  this->readLines( 5 );
+  lines += 5;
+  long length = -1;
+  std::istringstream( this->line_.substr( 0, 9 ) ) >> length;
+  if ( length < 0 ) {
+
+    Log::error( "Could not read the length of the XSS array" );
+    Log::info( "The table starts on line {}", this->lineNumber_ );
+    throw std::exception();
+  }
+
+  // the second NXS line, the JXS array and the XSS array
+  const std::size_t remaining = 5 + ( length + 3 ) / 4;
+  this->readLines( remaining );
+  lines += remaining;
+
+  try {
+
+    State< std::string::const_iterator > state{ this->lineNumber_,
+                                                this->buffer_.cbegin(),
+                                                this->buffer_.cend() };
+    Table table( state );
+    this->lineNumber_ += lines;
+    return table;
+  }
+  catch( std::exception& e ) {
+
+    Log::info( "Error while reading the ACE table starting on line {}",
+               this->lineNumber_ );
+    throw e;
+  }
+}
@@ -0,0 +1,16 @@
+/**
+ *  @brief Read the next line from the stream into the buffer
+ *
+ *  @return false if there are no more lines in the stream
+ */
+bool readLine() {
+
+  if ( not std::getline( *this->in_, this->line_ ) ) {
+
+    return false;
+  }
+
+  this->buffer_.append( this->line_ );
+  this->buffer_.push_back( '\n' );
+  return true;
+}
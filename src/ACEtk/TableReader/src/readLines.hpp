@@ -0,0 +1,17 @@
+/**
+ *  @brief Read a number of lines from the stream into the buffer
+ *
+ *  @param[in] lines   the number of lines to read
+ */
+void readLines( std::size_t lines ) {
+
+  for ( ; lines > 0; --lines ) {
+
+    if ( not this->readLine() ) {
+
+      Log::error( "Unexpected end of stream while reading an ACE table" );
+      Log::info( "The table starts on line {}", this->lineNumber_ );
+      throw std::exception();
+    }
+  }
+}
@@ -0,0 +1,210 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/TableReader.hpp"
+
+// other includes
+#include <fstream>
+#include <sstream>
+#include "ACEtk/toConcatenatedFile.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+std::string chunk();
+std::string chunkWith201Header();
+void writeFile( const std::string&, const std::string& );
+std::string readFile( const std::string& );
+void verifyChunk( const Table& );
+
+SCENARIO( "TableReader" ) {
+
+  GIVEN( "a stream with a concatenated ACE file" ) {
+
+    std::string string = chunk() + chunkWith201Header() + chunk();
+
+    WHEN( "the tables are read one at a time" ) {
+
+      std::istringstream in( string );
+      TableReader reader( in );
+
+      THEN( "the tables are read correctly and in order" ) {
+
+        CHECK( 1 == reader.lineNumber() );
+        auto first = reader.next();
+        CHECK( first.has_value() );
+        CHECK( true == std::holds_alternative< Table::Header >( first->header() ) );
+        verifyChunk( *first );
+
+        CHECK( 15 == reader.lineNumber() );
+        auto second = reader.next();
+        CHECK( second.has_value() );
+        CHECK( true == std::holds_alternative< Table::Header201 >( second->header() ) );
+        verifyChunk( *second );
+
+        CHECK( 31 == reader.lineNumber() );
+        auto third = reader.next();
+        CHECK( third.has_value() );
+        CHECK( true == std::holds_alternative< Table::Header >( third->header() ) );
+        verifyChunk( *third );
+
+        CHECK( 45 == reader.lineNumber() );
+        CHECK( std::nullopt == reader.next() );
+        CHECK( std::nullopt == reader.next() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the tables are read using the iterators" ) {
+
+      std::istringstream in( string );
+      TableReader reader( in );
+
+      std::vector< std::string > zaids;
+      for ( const auto& table : reader ) {
+
+        verifyChunk( table );
+        zaids.emplace_back( std::visit( [] ( const auto& header )
+                                           { return header.ZAID(); },
+                                        table.header() ) );
+      }
+
+      THEN( "all tables are read" ) {
+
+        CHECK( 3 == zaids.size() );
+        CHECK( "92238.80c" == zaids[0] );
+        CHECK( "92238.800nc" == zaids[1] );
+        CHECK( "92238.80c" == zaids[2] );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a concatenated ACE file" ) {
+
+    std::string string = chunk() + chunkWith201Header() + chunk() +
+                         chunkWith201Header();
+    writeFile( "streaming.ace", string );
+
+    WHEN( "the file is streamed into another file" ) {
+
+      TableReader reader( "streaming.ace" );
+      auto entries = toConcatenatedFile( reader.begin(), reader.end(),
+                                         "streamed.ace", 2 );
+
+      THEN( "the files are identical" ) {
+
+        CHECK( string == readFile( "streamed.ace" ) );
+        CHECK( 4 == entries.size() );
+        CHECK( 1 == entries[0].address() );
+        CHECK( 15 == entries[1].address() );
+        CHECK( 31 == entries[2].address() );
+        CHECK( 45 == entries[3].address() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an empty stream" ) {
+
+    std::istringstream in( "" );
+    TableReader reader( in );
+
+    THEN( "no tables are found" ) {
+
+      CHECK( std::nullopt == reader.next() );
+      CHECK( reader.begin() == reader.end() );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    WHEN( "the file does not exist" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( TableReader( "not-a-file.ace" ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the stream ends in the middle of a table" ) {
+
+      std::istringstream in( chunk() + chunk().substr( 0, 400 ) );
+      TableReader reader( in );
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK( reader.next().has_value() );
+        CHECK_THROWS( reader.next() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+void writeFile( const std::string& filename, const std::string& content ) {
+
+  std::ofstream out( filename, std::ios::binary );
+  out << content;
+}
+
+std::string readFile( const std::string& filename ) {
+
+  std::ifstream in( filename, std::ios::binary );
+  return std::string( std::istreambuf_iterator< char >( in ), {} );
+}
+
+std::string chunk() {
+
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWith201Header() {
+
+  return
+    "2.0.1                   92238.800nc            ENDF/B-VIII.0\n"
+    "  236.005800   2.5301E-08 2018-05-01          2\n"
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+void verifyChunk( const Table& chunk ) {
+
+  CHECK( 6 == chunk.data().NXS(1) );
+  CHECK( 33074 == chunk.data().NXS(2) );
+  CHECK( 1 == chunk.data().JXS(1) );
+  CHECK( 8 == chunk.data().JXS(32) );
+
+  CHECK( 6 == chunk.data().XSS().size() );
+  CHECK_THAT( 1.00000000000E+00, WithinRel( chunk.data().XSS(1) ) );
+  CHECK_THAT( 1.03125000000E+00, WithinRel( chunk.data().XSS(2) ) );
+  CHECK_THAT( 1.06250000000E+00, WithinRel( chunk.data().XSS(3) ) );
+  CHECK_THAT( 1.09375000000E+00, WithinRel( chunk.data().XSS(4) ) );
+  CHECK_THAT( 1.12500000000E+00, WithinRel( chunk.data().XSS(5) ) );
+  CHECK_THAT( 1.15625000000E+00, WithinRel( chunk.data().XSS(6) ) );
+}
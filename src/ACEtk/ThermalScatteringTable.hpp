@@ -5,6 +5,7 @@
 
 // other includes
 #include "ACEtk/Table.hpp"
+#include "ACEtk/BlockSelection.hpp"
 #include "ACEtk/thermal/CrossSectionBlock.hpp"
 #include "ACEtk/thermal/InelasticAngularDistributionBlock.hpp"
 #include "ACEtk/thermal/ElasticAngularDistributionBlock.hpp"
@@ -21,7 +22,31 @@ namespace ACEtk {
  */
 class ThermalScatteringTable : protected Table {
 
+public:
+
+  /* type aliases */
+
+  /**
+   *  @brief The blocks of the table that can be selected for loading
+   */
+  enum class Block : unsigned int {
+
+    ITIE = 0, ITXE, ITCE, ITCA, ITCEI, ITCAI
+  };
+  using BlockSelection = ACEtk::BlockSelection< Block >;
+
+  /**
+   *  @brief Combine two blocks into a block selection
+   */
+  friend constexpr BlockSelection operator|( Block left, Block right ) {
+
+    return BlockSelection( left ) | right;
+  }
+
+private:
+
   /* fields */
+  BlockSelection blocks_;
   thermal::ITIE itie_;
   thermal::ITXE itxe_;
   std::optional< thermal::ITCE > itce_;
@@ -33,15 +58,23 @@ class ThermalScatteringTable : protected Table {
   #include "ACEtk/ThermalScatteringTable/src/generateBlocks.hpp"
   #include "ACEtk/ThermalScatteringTable/src/generateData.hpp"
   #include "ACEtk/ThermalScatteringTable/src/verifyType.hpp"
+  #include "ACEtk/ThermalScatteringTable/src/verifyBlock.hpp"
 
 public:
 
   #include "ACEtk/ThermalScatteringTable/src/ctor.hpp"
 
   using Table::header;
-  using Table::data;
   using Table::print;
 
+  /**
+   *  @brief Return the data arrays
+   *
+   *  The blocks of the table refer to the XSS array so only const access to
+   *  the data arrays is provided.
+   */
+  const Data& data() const { return Table::data(); }
+
   /**
    *  @brief Return the full ZAID or SZAID of the table
    */
@@ -190,7 +223,11 @@ public:
   /**
    *  @brief Return the inelastic thermal scattering cross section block
    */
-  const thermal::ITIE& ITIE() const { return this->itie_; }
+  const thermal::ITIE& ITIE() const {
+
+    this->verifyBlock( Block::ITIE );
+    return this->itie_;
+  }
 
   /**
    *  @brief Return the inelastic thermal scattering cross section block
@@ -203,7 +240,11 @@ public:
   /**
    *  @brief Return the inelastic thermal scattering angular distribution block
    */
-  const thermal::ITXE& ITXE() const { return this->itxe_; }
+  const thermal::ITXE& ITXE() const {
+
+    this->verifyBlock( Block::ITXE );
+    return this->itxe_;
+  }
 
   /**
    *  @brief Return the inelastic thermal scattering angular distribution block
@@ -216,7 +257,11 @@ public:
   /**
    *  @brief Return the coherent elastic thermal scattering cross section block
    */
-  const std::optional< thermal::ITCE >& ITCE() const { return this->itce_; }
+  const std::optional< thermal::ITCE >& ITCE() const {
+
+    this->verifyBlock( Block::ITCE );
+    return this->itce_;
+  }
 
   /**
    *  @brief Return the coherent elastic thermal scattering cross section block
@@ -230,7 +275,11 @@ public:
    *  @brief Return the coherent elastic thermal scattering angular distribution
    *         block
    */
-  const std::optional< thermal::ITCA >& ITCA() const { return this->itca_; }
+  const std::optional< thermal::ITCA >& ITCA() const {
+
+    this->verifyBlock( Block::ITCA );
+    return this->itca_;
+  }
 
   /**
    *  @brief Return the coherent elastic thermal scattering angular distribution
@@ -244,7 +293,11 @@ public:
   /**
    *  @brief Return the incoherent elastic thermal scattering cross section block
    */
-  const std::optional< thermal::ITCEI >& ITCEI() const { return this->itcei_; }
+  const std::optional< thermal::ITCEI >& ITCEI() const {
+
+    this->verifyBlock( Block::ITCEI );
+    return this->itcei_;
+  }
 
   /**
    *  @brief Return the incoherent elastic thermal scattering cross section block
@@ -258,7 +311,11 @@ public:
    *  @brief Return the incoherent elastic thermal scattering angular distribution
    *         block
    */
-  const std::optional< thermal::ITCAI >& ITCAI() const { return this->itcai_; }
+  const std::optional< thermal::ITCAI >& ITCAI() const {
+
+    this->verifyBlock( Block::ITCAI );
+    return this->itcai_;
+  }
 
   /**
    *  @brief Return the incoherent elastic thermal scattering angular distribution
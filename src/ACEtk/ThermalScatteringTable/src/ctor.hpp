@@ -1,9 +1,15 @@
 /**
  *  @brief Copy constructor using a generic table
  *
+ *  Only the selected blocks (and the blocks they depend on) are generated.
+ *  Requesting a block that was not selected results in an exception.
+ *
  *  @param[in] table    the generic table to be copied
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-ThermalScatteringTable( const Table& table ): Table( table ) {
+ThermalScatteringTable( const Table& table,
+                        BlockSelection blocks = BlockSelection::all() ) :
+  Table( table ), blocks_( blocks ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -12,9 +18,15 @@ ThermalScatteringTable( const Table& table ): Table( table ) {
 /**
  *  @brief Move constructor using a generic table
  *
+ *  Only the selected blocks (and the blocks they depend on) are generated.
+ *  Requesting a block that was not selected results in an exception.
+ *
  *  @param[in] table    the generic table to be moved
+ *  @param[in] blocks   the blocks to be loaded (all blocks by default)
  */
-ThermalScatteringTable( Table&& table ): Table( std::move( table ) ) {
+ThermalScatteringTable( Table&& table,
+                        BlockSelection blocks = BlockSelection::all() ) :
+  Table( std::move( table ) ), blocks_( blocks ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -26,7 +38,7 @@ ThermalScatteringTable( Table&& table ): Table( std::move( table ) ) {
  *  @param[in] table    the thermal scattering table to be copied
  */
 ThermalScatteringTable( const ThermalScatteringTable& table ) :
-  Table( table ) {
+  Table( table ), blocks_( table.blocks_ ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -38,7 +50,7 @@ ThermalScatteringTable( const ThermalScatteringTable& table ) :
  *  @param[in] table    the thermal scattering table to be moved
  */
 ThermalScatteringTable( ThermalScatteringTable&& table ) :
-  Table( std::move( table ) ) {
+  Table( std::move( table ) ), blocks_( table.blocks_ ) {
 
   this->verifyType();
   this->generateBlocks();
@@ -54,6 +66,7 @@ ThermalScatteringTable& operator=( const ThermalScatteringTable& base ) {
   if ( this != &base ) {
 
     Table::operator=( base );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
@@ -70,6 +83,7 @@ ThermalScatteringTable& operator=( ThermalScatteringTable&& base ) {
   if ( this != &base ) {
 
     Table::operator=( std::move( base ) );
+    this->blocks_ = base.blocks_;
     this->verifyType();
     this->generateBlocks();
   }
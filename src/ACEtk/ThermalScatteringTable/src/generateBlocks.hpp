@@ -29,6 +29,24 @@ auto block( std::size_t index ) const {
 
 void generateBlocks() {
 
+  // blocks used by other blocks are always generated
+  if ( this->blocks_.contains( Block::ITXE ) ) {
+
+    this->blocks_ |= Block::ITIE;
+  }
+  if ( this->blocks_.contains( Block::ITCA ) ) {
+
+    this->blocks_ |= Block::ITCE;
+  }
+  if ( this->blocks_.contains( Block::ITCAI ) ) {
+
+    this->blocks_ |= Block::ITCEI;
+  }
+
+  // reset blocks
+  this->itie_ = thermal::ITIE();
+  this->itxe_ = thermal::ITXE();
+
   // reset optional blocks
   this->itce_ = std::nullopt;
   this->itca_ = std::nullopt;
@@ -40,32 +58,41 @@ void generateBlocks() {
 
   // inelastic thermal scattering data
   bool present = this->data().JXS(1) > 0 ? true : false;
-  auto iterators = block( 1 );
-  this->itie_ = thermal::ITIE( present ? iterators.first : begin,
-                               present ? iterators.second : begin );
-
-  iterators = block( 3 );
-  this->itxe_ = thermal::ITXE( present ? this->IFENG() : 0,
-                               present ? this->IFENG() < 2 ? this->NIEB() : 0 : 0,
-                               present ? this->IFENG() < 2 ? this->NIL() + 1
-                                                           : this->NIL() - 1
-                                       : 0,
-                               present ? this->ITIE().NE() : 0,
-                               present ? this->data().JXS(3) : 1,
-                               present ? iterators.first : begin,
-                               present ? iterators.second : begin );
+  if ( this->blocks_.contains( Block::ITIE ) ) {
+
+    auto iterators = block( 1 );
+    this->itie_ = thermal::ITIE( present ? iterators.first : begin,
+                                 present ? iterators.second : begin );
+  }
+
+  if ( this->blocks_.contains( Block::ITXE ) ) {
+
+    auto iterators = block( 3 );
+    this->itxe_ = thermal::ITXE( present ? this->IFENG() : 0,
+                                 present ? this->IFENG() < 2 ? this->NIEB() : 0 : 0,
+                                 present ? this->IFENG() < 2 ? this->NIL() + 1
+                                                             : this->NIL() - 1
+                                         : 0,
+                                 present ? this->ITIE().NE() : 0,
+                                 present ? this->data().JXS(3) : 1,
+                                 present ? iterators.first : begin,
+                                 present ? iterators.second : begin );
+  }
 
   // coherent elastic thermal scattering data
   present = this->IDPNC() > 3 ? true : false;
   if ( present ) {
 
-    iterators = block( 4 );
-    this->itce_ = thermal::ITCE( iterators.first, iterators.second );
+    if ( this->blocks_.contains( Block::ITCE ) ) {
+
+      auto iterators = block( 4 );
+      this->itce_ = thermal::ITCE( iterators.first, iterators.second );
+    }
 
     present = this->NCL() + 1 != 0 ? true : false;
-    if ( present ) {
+    if ( present && this->blocks_.contains( Block::ITCA ) ) {
 
-      iterators = block( 6 );
+      auto iterators = block( 6 );
       this->itca_ = thermal::ITCA( iterators.first, iterators.second,
                                    this->ITCE()->NE(), this->NCL() + 1 );
     }
@@ -75,13 +102,19 @@ void generateBlocks() {
   present = this->IDPNC() == 3 || this->IDPNC() == 5 ? true : false;
   if ( present ) {
 
-    iterators = this->IDPNC() == 3 ? block( 4 ) : block( 7 );
-    this->itcei_ = thermal::ITCEI( iterators.first, iterators.second );
+    if ( this->blocks_.contains( Block::ITCEI ) ) {
 
-    iterators = this->IDPNC() == 3 ? block( 6 ) : block( 9 );
-    this->itcai_ = thermal::ITCA( iterators.first, iterators.second,
-                                  this->ITCEI()->NE(),
-                                  this->IDPNC() == 3 ? this->NCL() + 1
-                                                     : this->NCLI() + 1 );
+      auto iterators = this->IDPNC() == 3 ? block( 4 ) : block( 7 );
+      this->itcei_ = thermal::ITCEI( iterators.first, iterators.second );
+    }
+
+    if ( this->blocks_.contains( Block::ITCAI ) ) {
+
+      auto iterators = this->IDPNC() == 3 ? block( 6 ) : block( 9 );
+      this->itcai_ = thermal::ITCA( iterators.first, iterators.second,
+                                    this->ITCEI()->NE(),
+                                    this->IDPNC() == 3 ? this->NCL() + 1
+                                                       : this->NCLI() + 1 );
+    }
   }
 }
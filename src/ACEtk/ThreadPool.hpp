@@ -0,0 +1,68 @@
+#ifndef NJOY_ACETK_THREADPOOL
+#define NJOY_ACETK_THREADPOOL
+
+// system includes
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// other includes
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A fixed size pool of worker threads
+ *
+ *  Tasks submitted to the pool are executed in submission order by the first
+ *  available worker thread. The result of a task (or the exception it threw)
+ *  is made available through an std::future.
+ *
+ *  Tasks should not wait on the result of other tasks submitted to the same
+ *  pool since all workers could end up waiting.
+ */
+class ThreadPool {
+
+  /* fields */
+  std::vector< std::thread > workers_;
+  std::deque< std::function< void() > > tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_ = false;
+
+  /* auxiliary functions */
+  #include "ACEtk/ThreadPool/src/work.hpp"
+
+public:
+
+  /* constructor */
+  #include "ACEtk/ThreadPool/src/ctor.hpp"
+
+  /**
+   *  @brief Return the default number of threads (the hardware concurrency)
+   */
+  static unsigned int defaultSize() {
+
+    return std::max( 1u, std::thread::hardware_concurrency() );
+  }
+
+  /**
+   *  @brief Return the number of worker threads
+   */
+  unsigned int size() const { return this->workers_.size(); }
+
+  #include "ACEtk/ThreadPool/src/submit.hpp"
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
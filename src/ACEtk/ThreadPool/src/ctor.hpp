@@ -0,0 +1,38 @@
+ThreadPool( const ThreadPool& ) = delete;
+ThreadPool( ThreadPool&& ) = delete;
+ThreadPool& operator=( const ThreadPool& ) = delete;
+ThreadPool& operator=( ThreadPool&& ) = delete;
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] threads   the number of worker threads (at least 1)
+ */
+ThreadPool( unsigned int threads = defaultSize() ) {
+
+  threads = std::max( 1u, threads );
+  this->workers_.reserve( threads );
+  for ( unsigned int i = 0; i < threads; ++i ) {
+
+    this->workers_.emplace_back( [this] { this->work(); } );
+  }
+}
+
+/**
+ *  @brief Destructor
+ *
+ *  All tasks that were already submitted are finished before the worker
+ *  threads are joined.
+ */
+~ThreadPool() {
+
+  {
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    this->stop_ = true;
+  }
+  this->condition_.notify_all();
+  for ( auto& worker : this->workers_ ) {
+
+    worker.join();
+  }
+}
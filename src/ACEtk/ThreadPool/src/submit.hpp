@@ -0,0 +1,23 @@
+/**
+ *  @brief Submit a task to the pool
+ *
+ *  @param[in] function   the task to be executed
+ *
+ *  @return a future to the result of the task
+ */
+template< typename Function >
+auto submit( Function&& function ) {
+
+  using Result = std::invoke_result_t< std::decay_t< Function > >;
+
+  // std::function requires a copyable target, std::packaged_task is not
+  auto task = std::make_shared< std::packaged_task< Result() > >(
+                  std::forward< Function >( function ) );
+  std::future< Result > result = task->get_future();
+  {
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    this->tasks_.emplace_back( [task] { ( *task )(); } );
+  }
+  this->condition_.notify_one();
+  return result;
+}
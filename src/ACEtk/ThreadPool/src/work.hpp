@@ -0,0 +1,19 @@
+void work() {
+
+  while ( true ) {
+
+    std::function< void() > task;
+    {
+      std::unique_lock< std::mutex > lock( this->mutex_ );
+      this->condition_.wait( lock, [this] { return this->stop_ ||
+                                                   !this->tasks_.empty(); } );
+      if ( this->tasks_.empty() ) {
+
+        return;
+      }
+      task = std::move( this->tasks_.front() );
+      this->tasks_.pop_front();
+    }
+    task();
+  }
+}
@@ -0,0 +1,86 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ACEtk/ThreadPool.hpp"
+
+// other includes
+#include <atomic>
+#include <stdexcept>
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+SCENARIO( "ThreadPool" ) {
+
+  GIVEN( "a thread pool" ) {
+
+    WHEN( "the number of threads is given" ) {
+
+      ThreadPool pool( 4 );
+
+      THEN( "the number of threads is correct" ) {
+
+        CHECK( 4 == pool.size() );
+      } // THEN
+
+      THEN( "tasks can be submitted and their results retrieved" ) {
+
+        std::vector< std::future< int > > results;
+        for ( int i = 0; i < 100; ++i ) {
+
+          results.emplace_back( pool.submit( [i] { return i * i; } ) );
+        }
+
+        for ( int i = 0; i < 100; ++i ) {
+
+          CHECK( i * i == results[i].get() );
+        }
+      } // THEN
+
+      THEN( "exceptions thrown by a task are propagated" ) {
+
+        auto result = pool.submit( [] () -> int { throw std::runtime_error( "task" ); } );
+        CHECK_THROWS( result.get() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "no threads are requested" ) {
+
+      ThreadPool pool( 0 );
+
+      THEN( "at least one thread is available" ) {
+
+        CHECK( 1 == pool.size() );
+        CHECK( 2 == pool.submit( [] { return 2; } ).get() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the default number of threads is used" ) {
+
+      ThreadPool pool;
+
+      THEN( "the number of threads is the default size" ) {
+
+        CHECK( ThreadPool::defaultSize() == pool.size() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the pool is destroyed" ) {
+
+      std::atomic< int > counter = 0;
+      {
+        ThreadPool pool( 2 );
+        for ( int i = 0; i < 50; ++i ) {
+
+          pool.submit( [&counter] { ++counter; } );
+        }
+      }
+
+      THEN( "all submitted tasks have been executed" ) {
+
+        CHECK( 50 == counter );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
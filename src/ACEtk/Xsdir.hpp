@@ -4,12 +4,32 @@
 // system includes
 #include <algorithm>
 #include <map>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <fstream>
 #include <locale>
 
 // other includes
 #include "ACEtk/XsdirEntry.hpp"
+#include "ACEtk/FileIndex.hpp"
+#include "ACEtk/LineIndex.hpp"
+#include "ACEtk/MappedFile.hpp"
+#include "ACEtk/Table.hpp"
+#include "ACEtk/ThreadPool.hpp"
+#include "ACEtk/Zaid.hpp"
+#include "ACEtk/fromBinaryFile.hpp"
+#include "ACEtk/peekHeader.hpp"
+#include "tools/std20/views.hpp"
 
 namespace njoy {
 namespace ACEtk {
@@ -25,21 +45,47 @@ namespace ACEtk {
  */
 class Xsdir {
 
+  /* auxiliary types */
+  struct LineIndexCache {
+
+    struct Entry {
+
+      std::shared_future< std::shared_ptr< const LineIndex > > index;
+      std::int64_t time = 0;
+    };
+
+    std::mutex mutex;
+    std::map< std::string, Entry > indices;
+  };
+
+  struct SecondaryIndices {
+
+    std::unordered_map< std::uint32_t, std::vector< std::size_t > > za;
+    std::unordered_map< std::uint32_t, std::vector< std::size_t > > type;
+    std::unordered_map< std::uint64_t, std::vector< std::size_t > > zaAndType;
+    std::unordered_map< std::uint64_t, std::vector< std::size_t > > temperatures;
+  };
+
   /* fields */
   std::optional< std::string > datapath_;
   std::map< unsigned int, double > awr_;
   std::vector< XsdirEntry > entries_;
   std::unordered_map< std::string, std::size_t > indices_;
+  SecondaryIndices secondary_;
+  std::shared_ptr< LineIndexCache > cache_ = std::make_shared< LineIndexCache >();
 
   /* auxiliary functions */
   #include "ACEtk/Xsdir/src/parse.hpp"
+  #include "ACEtk/Xsdir/src/parseBuffer.hpp"
   #include "ACEtk/Xsdir/src/indices.hpp"
+  #include "ACEtk/Xsdir/src/lineIndex.hpp"
 
 public:
 
   /* constructor */
   #include "ACEtk/Xsdir/src/ctor.hpp"
   #include "ACEtk/Xsdir/src/fromFile.hpp"
+  #include "ACEtk/Xsdir/src/fromDirectory.hpp"
 
   /**
    *  @brief Return the optional datapath
@@ -78,6 +124,9 @@ public:
    */
   const std::vector< XsdirEntry >& entries() const { return this->entries_; }
 
+  #include "ACEtk/Xsdir/src/entries.hpp"
+  #include "ACEtk/Xsdir/src/temperatures.hpp"
+
   /**
    *  @brief Return the xsdir entry for a given ZAID
    */
@@ -95,6 +144,8 @@ public:
     }
   }
 
+  #include "ACEtk/Xsdir/src/filePath.hpp"
+  #include "ACEtk/Xsdir/src/load.hpp"
   #include "ACEtk/Xsdir/src/print.hpp"
 };
 
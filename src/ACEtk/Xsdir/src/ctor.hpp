@@ -13,7 +13,8 @@ Xsdir( std::map< unsigned int, double > ratios,
        std::vector< XsdirEntry > entries,
        std::optional< std::string > datapath = std::nullopt ) :
   datapath_( std::move( datapath ) ), awr_( std::move( ratios ) ),
-  entries_( std::move( entries ) ), indices_( indices( entries_ ) ) {}
+  entries_( std::move( entries ) ), indices_( indices( entries_ ) ),
+  secondary_( secondaryIndices( entries_ ) ) {}
 
 /**
  *  @brief Constructor (from a stream)
@@ -0,0 +1,37 @@
+/**
+ *  @brief Return the xsdir entries for a given ZA or SZA value
+ *
+ *  The entries are given in the order of the xsdir file.
+ *
+ *  @param[in] za   the ZA or SZA value (e.g. 92235 or 1095242)
+ */
+auto entries( std::uint32_t za ) const {
+
+  return this->select( lookup( this->secondary_.za, za ) );
+}
+
+/**
+ *  @brief Return the xsdir entries for a given ZA or SZA value and class
+ *
+ *  The entries are given in the order of the xsdir file.
+ *
+ *  @param[in] za     the ZA or SZA value (e.g. 92235 or 1095242)
+ *  @param[in] type   the class letters (e.g. c or nc)
+ */
+auto entries( std::uint32_t za, std::string_view type ) const {
+
+  return this->select( lookup( this->secondary_.zaAndType,
+                               key( za, Zaid::pack( type ) ) ) );
+}
+
+/**
+ *  @brief Return the xsdir entries for a given class
+ *
+ *  The entries are given in the order of the xsdir file.
+ *
+ *  @param[in] type   the class letters (e.g. c, nc, t or p)
+ */
+auto entries( std::string_view type ) const {
+
+  return this->select( lookup( this->secondary_.type, Zaid::pack( type ) ) );
+}
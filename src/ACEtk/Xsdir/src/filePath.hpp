@@ -0,0 +1,29 @@
+/**
+ *  @brief Return the path to the file containing a table
+ *
+ *  The access route of the entry (if any) is prepended to the file name.
+ *  Without an access route, the data path of the xsdir file (if any) is
+ *  prepended instead. Absolute file names are returned as is.
+ *
+ *  @param[in] entry   the xsdir entry of the table
+ */
+std::string filePath( const XsdirEntry& entry ) const {
+
+  const std::string& filename = entry.fileName();
+  if ( ( not filename.empty() ) && ( filename.front() == '/' ) ) {
+
+    return filename;
+  }
+
+  if ( entry.accessRoute() ) {
+
+    return entry.accessRoute().value() + '/' + filename;
+  }
+
+  if ( this->dataPath() ) {
+
+    return this->dataPath().value() + '/' + filename;
+  }
+
+  return filename;
+}
@@ -0,0 +1,122 @@
+/**
+ *  @brief Factory function to make an xsdir for the ACE files in a directory
+ *
+ *  The directory is searched recursively and every regular file in it is
+ *  scanned as a concatenated (type 1) ACE file. Only the header, IZAW, NXS
+ *  and JXS arrays of each table are read (see peekConcatenatedFile) and the
+ *  files are scanned concurrently. Files that do not start with an ACE table
+ *  (e.g. an existing xsdir file) are skipped with a warning and sidecar
+ *  index files (and temporary files left while writing them) are ignored. When a file starts with an ACE table but cannot
+ *  be read completely, an exception is thrown so that tables are never left
+ *  out of the xsdir without notice.
+ *
+ *  The entries are given in the order of the file names (relative to the
+ *  directory, which is used as the datapath of the xsdir) and in the order
+ *  of the tables in each file. The address of an entry is the line number
+ *  of the table and its length is the length of the XSS array. The atomic
+ *  weight ratios are taken from the first table found for each ZA or SZA
+ *  value. The ptable flag is set for continuous energy tables that have
+ *  probability tables for the unresolved resonance range.
+ *
+ *  @param[in] directory   the directory
+ *  @param[in] threads     the number of threads to use (default: the
+ *                         hardware concurrency)
+ */
+static Xsdir fromDirectory( const std::string& directory,
+                            unsigned int threads = ThreadPool::defaultSize() ) {
+
+  namespace fs = std::filesystem;
+
+  std::error_code error;
+  if ( not fs::is_directory( directory, error ) ) {
+
+    Log::error( "Could not find the directory \'{}\'", directory );
+    throw std::exception();
+  }
+
+  // sidecar indices and their temporary files are not ACE files
+  auto sidecar = [] ( const fs::path& path ) {
+
+    const std::string name = path.filename().string();
+    auto ends = [&name] ( const std::string& suffix ) {
+
+      return ( name.size() >= suffix.size() ) &&
+             ( name.compare( name.size() - suffix.size(), suffix.size(),
+                             suffix ) == 0 );
+    };
+    return ends( FileIndex::sidecar( "" ) ) ||
+           ends( FileIndex::temporarySidecar( "" ) );
+  };
+
+  // the regular files in the directory, in order of their relative path
+  std::vector< std::string > files;
+  for ( const auto& entry : fs::recursive_directory_iterator( directory ) ) {
+
+    if ( entry.is_regular_file() && ( not sidecar( entry.path() ) ) ) {
+
+      files.emplace_back(
+          entry.path().lexically_relative( directory ).generic_string() );
+    }
+  }
+  std::sort( files.begin(), files.end() );
+
+  auto scan = [&directory] ( const std::string& file ) {
+
+    const std::string path = ( fs::path( directory ) / file ).string();
+    try {
+
+      return peekConcatenatedFile( path );
+    }
+    catch ( std::exception& ) {
+
+      // a file that starts with an ACE table is an ACE file that is not valid
+      bool ace = true;
+      try {
+
+        peekHeader( path );
+      }
+      catch ( std::exception& ) {
+
+        ace = false;
+      }
+
+      if ( ace ) {
+
+        Log::error( "Could not read all ACE tables in \'{}\'", path );
+        throw;
+      }
+      Log::warning( "Skipping \'{}\', it is not an ACE file", path );
+    }
+    return std::vector< Table::Summary >{};
+  };
+
+  std::vector< std::future< std::vector< Table::Summary > > > futures;
+  ThreadPool pool( std::max( 1u, std::min( threads,
+                                           static_cast< unsigned int >( files.size() ) ) ) );
+  for ( const auto& file : files ) {
+
+    futures.emplace_back( pool.submit( [&scan, &file] { return scan( file ); } ) );
+  }
+
+  std::map< unsigned int, double > ratios;
+  std::vector< XsdirEntry > entries;
+  for ( std::size_t i = 0; i < files.size(); ++i ) {
+
+    for ( const auto& summary : futures[i].get() ) {
+
+      const Zaid zaid( summary.ZAID() );
+      if ( zaid.isNumeric() ) {
+
+        ratios.emplace( zaid.SZA(), summary.AWR() );
+      }
+
+      const unsigned int address = summary.lineNumber();
+      const unsigned int length = summary.data().NXS(1);
+      const std::optional< double > temperature = summary.TEMP();
+      entries.emplace_back( summary.ZAID(), summary.AWR(), files[i],
+                            address, length, temperature, summary.ptable() );
+    }
+  }
+
+  return Xsdir( std::move( ratios ), std::move( entries ), directory );
+}
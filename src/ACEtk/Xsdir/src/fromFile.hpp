@@ -1,15 +1,20 @@
 /**
  *  @brief Factory function to make an xsdir from a file
  *
+ *  The file is memory mapped and parsed directly from the mapping.
+ *
  *  @param[in] filename   the file name
  */
 static auto fromFile( const std::string& filename ) {
 
-  std::ifstream in( filename );
-  if ( not in ) {
+  MappedFile file( filename );
+  try {
+
+    return parse( file.begin(), file.end() );
+  }
+  catch( std::exception& e ) {
 
-    njoy::Log::error( "Could not open file \'{}\'", filename );
-    throw std::exception();
+    Log::info( "Error while reading xsdir file \'{}\'", filename );
+    throw e;
   }
-  return Xsdir( in );
 }
@@ -8,3 +8,112 @@ indices( const std::vector< XsdirEntry > entries ) {
   }
   return indices;
 }
+
+/**
+ *  @brief Return the secondary indices of the xsdir entries
+ *
+ *  The entries are indexed by SZA value, by class letters and by the
+ *  combination of both (in the order of the xsdir file). The entries with a
+ *  temperature are also indexed by the combination of SZA value and class
+ *  letters in order of increasing temperature (entries with the same
+ *  temperature remain in the order of the xsdir file).
+ *
+ *  @param[in] entries   the xsdir entries
+ */
+static SecondaryIndices
+secondaryIndices( const std::vector< XsdirEntry >& entries ) {
+
+  SecondaryIndices indices;
+  for ( std::size_t i = 0; i < entries.size(); ++i ) {
+
+    const Zaid zaid( entries[i].ZAID() );
+    indices.za[ zaid.SZA() ].push_back( i );
+    indices.type[ zaid.packedType() ].push_back( i );
+    indices.zaAndType[ key( zaid.SZA(), zaid.packedType() ) ].push_back( i );
+    if ( entries[i].temperature() ) {
+
+      indices.temperatures[ key( zaid.SZA(), zaid.packedType() ) ].push_back( i );
+    }
+  }
+  for ( auto& pair : indices.temperatures ) {
+
+    std::stable_sort( pair.second.begin(), pair.second.end(),
+                      [&entries] ( std::size_t left, std::size_t right ) {
+
+                        return entries[left].temperature().value() <
+                               entries[right].temperature().value();
+                      } );
+  }
+  return indices;
+}
+
+/**
+ *  @brief Return the combined key for an SZA value and packed class letters
+ */
+static std::uint64_t key( std::uint32_t sza, std::uint32_t type ) {
+
+  return ( static_cast< std::uint64_t >( sza ) << 16 ) | type;
+}
+
+/**
+ *  @brief Return the entry indices in a secondary index for a given key
+ *
+ *  @param[in] index   the secondary index
+ *  @param[in] key     the key
+ */
+template< typename Key >
+static const std::vector< std::size_t >&
+lookup( const std::unordered_map< Key, std::vector< std::size_t > >& index,
+        Key key ) {
+
+  static const std::vector< std::size_t > none;
+  auto iter = index.find( key );
+  return iter != index.end() ? iter->second : none;
+}
+
+/**
+ *  @brief Return a view on the entries for a range of entry indices
+ *
+ *  @param[in] first   the iterator to the first entry index
+ *  @param[in] last    the iterator past the last entry index
+ */
+auto select( std::vector< std::size_t >::const_iterator first,
+             std::vector< std::size_t >::const_iterator last ) const {
+
+  return njoy::tools::std20::ranges::subrange( first, last )
+         | njoy::tools::std20::views::transform(
+               [this] ( std::size_t index ) -> const XsdirEntry&
+                      { return this->entries_[ index ]; } );
+}
+
+/**
+ *  @brief Return a view on the entries for a list of entry indices
+ *
+ *  @param[in] indices   the entry indices
+ */
+auto select( const std::vector< std::size_t >& indices ) const {
+
+  return this->select( indices.begin(), indices.end() );
+}
+
+/**
+ *  @brief Return the temperature index for a given ZA or SZA value and class
+ *
+ *  An exception is thrown when there are no entries with a temperature.
+ *
+ *  @param[in] za     the ZA or SZA value
+ *  @param[in] type   the class letters
+ */
+const std::vector< std::size_t >&
+temperatureIndices( std::uint32_t za, std::string_view type ) const {
+
+  const auto& indices = lookup( this->secondary_.temperatures,
+                                key( za, Zaid::pack( type ) ) );
+  if ( indices.empty() ) {
+
+    Log::error( "There are no xsdir entries with a temperature for ZA {} "
+                "and class \'{}\'", za, type );
+    throw std::exception();
+  }
+  return indices;
+}
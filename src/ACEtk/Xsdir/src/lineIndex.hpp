@@ -0,0 +1,80 @@
+/**
+ *  @brief Return the line index of a mapped file
+ *
+ *  The line index for each file is only constructed the first time a table
+ *  is loaded from it, using the sidecar index of the file when it has a
+ *  matching one (see FileIndex). An index that no longer matches the size or
+ *  the modification time of the file (or whose construction failed) is
+ *  constructed again. The cache is shared between copies of the xsdir.
+ *
+ *  The cache is only locked to look up or insert the index of a file: the
+ *  index itself is constructed without holding the lock, so that loading
+ *  tables from other files is not blocked. Concurrent requests for the same
+ *  file wait for a single construction of its index.
+ *
+ *  @param[in] file   the mapped file
+ */
+std::shared_ptr< const LineIndex > lineIndex( const MappedFile& file ) const {
+
+  using Index = std::shared_ptr< const LineIndex >;
+
+  const auto time = FileIndex::modificationTime( file.filename() );
+
+  auto stale = [&file] ( const std::shared_future< Index >& future ) {
+
+    if ( future.wait_for( std::chrono::seconds( 0 ) ) != std::future_status::ready ) {
+
+      return false;
+    }
+    try {
+
+      return future.get()->size() != file.size();
+    }
+    catch ( std::exception& ) {
+
+      return true;
+    }
+  };
+
+  while ( true ) {
+
+    std::promise< Index > promise;
+    std::shared_future< Index > future;
+    bool owner = false;
+    {
+      std::lock_guard< std::mutex > lock( this->cache_->mutex );
+      auto& entry = this->cache_->indices[ file.filename() ];
+      if ( ( not entry.index.valid() ) || ( entry.time != time ) ||
+           stale( entry.index ) ) {
+
+        entry.index = promise.get_future().share();
+        entry.time = time;
+        owner = true;
+      }
+      future = entry.index;
+    }
+
+    if ( owner ) {
+
+      try {
+
+        auto sidecar = FileIndex::fromSidecar( file.filename() );
+        promise.set_value(
+            sidecar && ( sidecar->lines().size() == file.size() )
+            ? std::make_shared< const LineIndex >( sidecar->lines() )
+            : std::make_shared< const LineIndex >( file.begin(), file.end() ) );
+      }
+      catch ( ... ) {
+
+        promise.set_exception( std::current_exception() );
+      }
+    }
+
+    // an index made for another version of the file is constructed again
+    auto index = future.get();
+    if ( index->size() == file.size() ) {
+
+      return index;
+    }
+  }
+}
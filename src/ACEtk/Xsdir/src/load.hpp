@@ -0,0 +1,67 @@
+/**
+ *  @brief Load the table for an xsdir entry
+ *
+ *  For a type 1 (text) file, the file is memory mapped and only the table
+ *  starting at the address of the entry is parsed, using a cached line index
+ *  to find the address without reading the preceding tables. For a type 2
+ *  (binary) file, the records of the table are read directly.
+ *
+ *  @param[in] entry   the xsdir entry of the table
+ */
+Table load( const XsdirEntry& entry ) const {
+
+  const std::string filename = this->filePath( entry );
+  try {
+
+    if ( entry.fileType() == 2 ) {
+
+      if ( ( not entry.recordLength() ) || ( not entry.entriesPerRecord() ) ) {
+
+        Log::error( "The xsdir entry for a binary table does not define the "
+                    "record length and number of entries per record" );
+        throw std::exception();
+      }
+      return fromBinaryFile( filename, entry.address(),
+                             entry.recordLength().value(),
+                             entry.entriesPerRecord().value() );
+    }
+    else if ( entry.fileType() != 1 ) {
+
+      Log::error( "Unsupported file type: {}", entry.fileType() );
+      throw std::exception();
+    }
+
+    MappedFile file( filename );
+    const auto index = this->lineIndex( file );
+    const char* begin = file.begin() + index->offset( file.begin(),
+                                                      entry.address() );
+    State< const char* > state{ entry.address(), begin, file.end() };
+    Table table( state );
+
+    if ( table.data().XSS().size() != entry.tableLength() ) {
+
+      Log::error( "The length of the table does not match the xsdir entry" );
+      Log::info( "Table length in the xsdir entry: {}", entry.tableLength() );
+      Log::info( "Table length in the file: {}", table.data().XSS().size() );
+      throw std::exception();
+    }
+
+    return table;
+  }
+  catch( std::exception& e ) {
+
+    Log::info( "Error while loading \'{}\' from file \'{}\'",
+               entry.ZAID(), filename );
+    throw e;
+  }
+}
+
+/**
+ *  @brief Load the table for a given ZAID
+ *
+ *  @param[in] zaid   the ZAID of the table
+ */
+Table load( const std::string& zaid ) const {
+
+  return this->load( this->entry( zaid ) );
+}
@@ -0,0 +1,259 @@
+/**
+ *  @brief Return the next line in a buffer, without surrounding whitespace
+ *
+ *  Comment lines (starting with '#') and empty lines are skipped.
+ *
+ *  @param[in,out] position   the current position in the buffer
+ *  @param[in]     end        the end of the buffer
+ *  @param[out]    line       the line
+ *
+ *  @return false if the end of the buffer was reached
+ */
+static bool nextLine( const char*& position, const char* end,
+                      std::string_view& line ) {
+
+  auto isSpace = [] ( char c ) { return std::isspace( static_cast< unsigned char >( c ) ); };
+
+  while ( position != end ) {
+
+    const char* newline = static_cast< const char* >(
+                              std::memchr( position, '\n', end - position ) );
+    const char* last = newline ? newline : end;
+    const char* first = position;
+    position = newline ? newline + 1 : end;
+
+    if ( ( first != last ) && ( *first == '#' ) ) {
+
+      continue;
+    }
+    while ( ( first != last ) && isSpace( *first ) ) { ++first; }
+    while ( ( last != first ) && isSpace( *( last - 1 ) ) ) { --last; }
+    if ( first != last ) {
+
+      line = std::string_view( first, last - first );
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ *  @brief Split a line into whitespace separated tokens
+ *
+ *  @param[in]     line     the line
+ *  @param[in,out] tokens   the tokens (new tokens are appended)
+ */
+static void tokenise( std::string_view line,
+                      std::vector< std::string_view >& tokens ) {
+
+  auto isSpace = [] ( char c ) { return std::isspace( static_cast< unsigned char >( c ) ); };
+
+  std::size_t i = 0;
+  while ( i < line.size() ) {
+
+    while ( ( i < line.size() ) && isSpace( line[i] ) ) { ++i; }
+    std::size_t j = i;
+    while ( ( j < line.size() ) && not isSpace( line[j] ) ) { ++j; }
+    if ( j > i ) {
+
+      tokens.emplace_back( line.substr( i, j - i ) );
+    }
+    i = j;
+  }
+}
+
+/**
+ *  @brief Return a lower case copy of a string
+ *
+ *  @param[in] string   the string
+ */
+static std::string lowerCase( std::string_view string ) {
+
+  std::string result( string );
+  toLowerCase( result );
+  return result;
+}
+
+/**
+ *  @brief Convert a token to an unsigned integer
+ *
+ *  @param[in]  token   the token
+ *  @param[out] value   the value
+ *
+ *  @return false if the token is not an unsigned integer
+ */
+static bool toInteger( std::string_view token, unsigned int& value ) {
+
+  const auto result = std::from_chars( token.data(), token.data() + token.size(), value );
+  return ( result.ec == std::errc() ) && ( result.ptr == token.data() + token.size() );
+}
+
+/**
+ *  @brief Convert a token to a real value
+ *
+ *  @param[in]  token   the token
+ *  @param[out] value   the value
+ *
+ *  @return false if the token is not a real value
+ */
+static bool toReal( std::string_view token, double& value ) {
+
+  char buffer[64];
+  if ( token.empty() || ( token.size() >= sizeof( buffer ) ) ) {
+
+    return false;
+  }
+  std::memcpy( buffer, token.data(), token.size() );
+  buffer[ token.size() ] = '\0';
+
+  char* last = nullptr;
+  value = std::strtod( buffer, &last );
+  return last == buffer + token.size();
+}
+
+/**
+ *  @brief Make an xsdir entry from its tokens
+ *
+ *  @param[in] tokens   the tokens of the entry (7, 10 or 11 tokens)
+ */
+static XsdirEntry makeEntry( const std::vector< std::string_view >& tokens ) {
+
+  double awr = 0.;
+  unsigned int filetype = 0;
+  unsigned int address = 0;
+  unsigned int length = 0;
+  unsigned int recordlength = 0;
+  unsigned int entries = 0;
+  double temperature = 0.;
+  bool ptable = false;
+
+  bool valid = ( ( tokens.size() == 7 ) || ( tokens.size() == 10 ) ||
+                 ( tokens.size() == 11 ) ) &&
+               toReal( tokens[1], awr ) && toInteger( tokens[4], filetype ) &&
+               toInteger( tokens[5], address ) && toInteger( tokens[6], length );
+  if ( valid && ( tokens.size() > 7 ) ) {
+
+    valid = toInteger( tokens[7], recordlength ) &&
+            toInteger( tokens[8], entries ) && toReal( tokens[9], temperature );
+    if ( valid && ( tokens.size() == 11 ) ) {
+
+      ptable = tokens[10] == "ptable";
+      valid = ptable;
+    }
+  }
+
+  if ( not valid ) {
+
+    Log::error( "Something went wrong while reading an xsdir entry" );
+    Log::info( "ZAID: {}", tokens.empty() ? std::string() : std::string( tokens[0] ) );
+    throw std::exception();
+  }
+
+  return XsdirEntry( std::string( tokens[0] ), awr, std::string( tokens[2] ),
+                     filetype, address, length,
+                     tokens[3] == "0"
+                       ? std::nullopt
+                       : std::optional< std::string >( tokens[3] ),
+                     recordlength == 0
+                       ? std::nullopt
+                       : std::optional< unsigned int >( recordlength ),
+                     entries == 0
+                       ? std::nullopt
+                       : std::optional< unsigned int >( entries ),
+                     temperature == 0
+                       ? std::nullopt
+                       : std::optional< double >( temperature ),
+                     ptable );
+}
+
+/**
+ *  @brief Parse an xsdir file in a buffer
+ *
+ *  This does the same as the stream based parse function but works directly
+ *  on a buffer (e.g. a memory mapped file) without using streams.
+ *
+ *  @param[in] begin   the start of the buffer
+ *  @param[in] end     the end of the buffer
+ */
+static Xsdir parse( const char* begin, const char* end ) {
+
+  const char* position = begin;
+  std::string_view line;
+  bool more = nextLine( position, end, line );
+
+  // verify for the presence of a datapath
+  std::optional< std::string > datapath = std::nullopt;
+  if ( more && ( lowerCase( line.substr( 0, 8 ) ) == "datapath" ) ) {
+
+    auto path = line.substr( 8 );
+    path.remove_prefix( std::min( path.size(), path.find_first_not_of( " \t" ) ) );
+    if ( ( not path.empty() ) && ( path.front() == '=' ) ) {
+
+      path.remove_prefix( 1 );
+      path.remove_prefix( std::min( path.size(), path.find_first_not_of( " \t" ) ) );
+      if ( not path.empty() ) {
+
+        datapath = std::string( path );
+      }
+    }
+    more = nextLine( position, end, line );
+  }
+
+  // verify for the atomic weight ratios
+  if ( ( not more ) || ( lowerCase( line ) != "atomic weight ratios" ) ) {
+
+    Log::error( "Expected \'atomic weight ratios\' but found \'{}\'", line );
+    throw std::exception();
+  }
+
+  // read ZA, AWR pairs
+  std::map< unsigned int, double > ratios;
+  std::vector< std::string_view > tokens;
+  while ( true ) {
+
+    if ( not nextLine( position, end, line ) ) {
+
+      Log::error( "Unexpected error while reading atomic weights" );
+      throw std::exception();
+    }
+    if ( lowerCase( line ) == "directory" ) {
+
+      break;
+    }
+
+    tokens.clear();
+    tokenise( line, tokens );
+    unsigned int za;
+    double awr;
+    for ( std::size_t i = 0; i + 1 < tokens.size(); i += 2 ) {
+
+      if ( not ( toInteger( tokens[i], za ) && toReal( tokens[i + 1], awr ) ) ) {
+
+        break;
+      }
+      ratios[ za ] = awr;
+    }
+  }
+
+  // read the entries (an entry is continued on the next line when its line
+  // ends with a '+')
+  std::vector< XsdirEntry > entries;
+  while ( nextLine( position, end, line ) ) {
+
+    tokens.clear();
+    while ( line.back() == '+' ) {
+
+      tokenise( line.substr( 0, line.size() - 1 ), tokens );
+      if ( not nextLine( position, end, line ) ) {
+
+        Log::error( "Expected an additional line but found the end of the file" );
+        throw std::exception();
+      }
+    }
+    tokenise( line, tokens );
+    entries.emplace_back( makeEntry( tokens ) );
+  }
+
+  return Xsdir( std::move( ratios ), std::move( entries ),
+                std::move( datapath ) );
+}
@@ -0,0 +1,71 @@
+/**
+ *  @brief Return the xsdir entries for a given ZA or SZA value and class
+ *         that have a temperature, in order of increasing temperature
+ *
+ *  @param[in] za     the ZA or SZA value (e.g. 92235 or 1095242)
+ *  @param[in] type   the class letters (e.g. c or nc)
+ */
+auto temperatures( std::uint32_t za, std::string_view type ) const {
+
+  return this->select( lookup( this->secondary_.temperatures,
+                               key( za, Zaid::pack( type ) ) ) );
+}
+
+/**
+ *  @brief Return the xsdir entries for a given ZA or SZA value and class
+ *         that bracket a given temperature
+ *
+ *  Two entries (in order of increasing temperature) are returned when the
+ *  temperature lies between the temperatures of two entries. A single entry
+ *  is returned when an entry has the requested temperature, or when the
+ *  temperature lies outside of the available temperatures (in which case the
+ *  entry with the lowest or highest temperature is returned).
+ *
+ *  @param[in] za            the ZA or SZA value (e.g. 92235 or 1095242)
+ *  @param[in] type          the class letters (e.g. c or nc)
+ *  @param[in] temperature   the temperature (in MeV)
+ */
+auto bracketingTemperatures( std::uint32_t za, std::string_view type,
+                             double temperature ) const {
+
+  const auto& indices = this->temperatureIndices( za, type );
+  auto upper = std::lower_bound(
+                   indices.begin(), indices.end(), temperature,
+                   [this] ( std::size_t index, double temperature ) {
+
+                     return this->entries_[ index ].temperature().value() < temperature;
+                   } );
+
+  auto lower = upper;
+  if ( upper == indices.end() ) {
+
+    lower = upper = std::prev( indices.end() );
+  }
+  else if ( ( this->entries_[ *upper ].temperature().value() != temperature ) &&
+            ( upper != indices.begin() ) ) {
+
+    lower = std::prev( upper );
+  }
+  return this->select( lower, std::next( upper ) );
+}
+
+/**
+ *  @brief Return the xsdir entry for a given ZA or SZA value and class with
+ *         the temperature nearest to a given temperature
+ *
+ *  When two entries are equally near, the entry with the lowest temperature
+ *  is returned.
+ *
+ *  @param[in] za            the ZA or SZA value (e.g. 92235 or 1095242)
+ *  @param[in] type          the class letters (e.g. c or nc)
+ *  @param[in] temperature   the temperature (in MeV)
+ */
+const XsdirEntry& nearestTemperature( std::uint32_t za, std::string_view type,
+                                      double temperature ) const {
+
+  auto entries = this->bracketingTemperatures( za, type, temperature );
+  const XsdirEntry& lower = entries.front();
+  const XsdirEntry& upper = entries.back();
+  return upper.temperature().value() - temperature <
+         temperature - lower.temperature().value() ? upper : lower;
+}
@@ -7,6 +7,7 @@ using Catch::Matchers::WithinRel;
 #include "ACEtk/Xsdir.hpp"
 
 // other includes
+#include <fstream>
 
 // convenience typedefs
 using namespace njoy::ACEtk;
@@ -17,6 +18,7 @@ std::string chunkWithUpperCaseAndTrailingWhitespace();
 void verifyChunk( const Xsdir& );
 std::string chunkWithoutDatapath();
 void verifyChunkWithoutDatapath( const Xsdir& );
+void writeFile( const std::string&, const std::string& );
 
 SCENARIO( "Xsdir" ) {
 
@@ -136,6 +138,39 @@ SCENARIO( "Xsdir" ) {
         CHECK( oss.str() == string );
       } // THEN
     } // WHEN
+
+    WHEN( "the data is read from a file" ) {
+
+      writeFile( "xsdir", string );
+      writeFile( "xsdir-comments", chunkWithCommentLines() );
+      writeFile( "xsdir-uppercase", chunkWithUpperCaseAndTrailingWhitespace() );
+
+      Xsdir chunk = Xsdir::fromFile( "xsdir" );
+      Xsdir comments = Xsdir::fromFile( "xsdir-comments" );
+      Xsdir uppercase = Xsdir::fromFile( "xsdir-uppercase" );
+
+      THEN( "an Xsdir can be constructed and members can be tested" ) {
+
+        verifyChunk( chunk );
+        verifyChunk( comments );
+        verifyChunk( uppercase );
+      } // THEN
+
+      THEN( "it can be printed" ) {
+
+        std::ostringstream oss;
+        oss << chunk;
+        CHECK( oss.str() == string );
+
+        oss.str( "" );
+        oss << comments;
+        CHECK( oss.str() == string );
+
+        oss.str( "" );
+        oss << uppercase;
+        CHECK( oss.str() == string );
+      } // THEN
+    } // WHEN
   } // GIVEN
 
   GIVEN( "valid data for an Xsdir instance without a datapath" ) {
@@ -203,6 +238,91 @@ SCENARIO( "Xsdir" ) {
       } // THEN
     } // WHEN
   } // GIVEN
+
+  GIVEN( "an Xsdir instance with entries at multiple temperatures" ) {
+
+    std::vector< XsdirEntry > entries = {
+
+      XsdirEntry( "92235.02c", 235., "file", 1, 1000, 5.1704e-8, false ),
+      XsdirEntry( "92235.00c", 235., "file", 1, 1000, 2.5301e-8, false ),
+      XsdirEntry( "92235.01c", 235., "file", 1, 1000, 5.1704e-8, false ),
+      XsdirEntry( "92235.03c", 235., "file", 1, 1000, 7.7556e-8, false ),
+      XsdirEntry( "92235.00p", 235., "file", 1, 1000 ),
+      XsdirEntry( "92238.00c", 238., "file", 1, 1000, 2.5301e-8, false )
+    };
+    Xsdir xsdir( {}, std::move( entries ) );
+
+    WHEN( "the entries are requested in order of increasing temperature" ) {
+
+      auto entries = xsdir.temperatures( 92235, "c" );
+
+      THEN( "the entries with a temperature are returned" ) {
+
+        CHECK( 4 == entries.size() );
+        CHECK( "92235.00c" == entries[0].ZAID() );
+        CHECK( "92235.02c" == entries[1].ZAID() );
+        CHECK( "92235.01c" == entries[2].ZAID() );
+        CHECK( "92235.03c" == entries[3].ZAID() );
+
+        CHECK( 0 == xsdir.temperatures( 92235, "p" ).size() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "bracketing temperatures are requested" ) {
+
+      THEN( "the bracketing entries are returned" ) {
+
+        auto entries = xsdir.bracketingTemperatures( 92235, "c", 3e-8 );
+        CHECK( 2 == entries.size() );
+        CHECK( "92235.00c" == entries[0].ZAID() );
+        CHECK( "92235.02c" == entries[1].ZAID() );
+
+        entries = xsdir.bracketingTemperatures( 92235, "c", 6e-8 );
+        CHECK( 2 == entries.size() );
+        CHECK( "92235.01c" == entries[0].ZAID() );
+        CHECK( "92235.03c" == entries[1].ZAID() );
+
+        entries = xsdir.bracketingTemperatures( 92235, "c", 5.1704e-8 );
+        CHECK( 1 == entries.size() );
+        CHECK( "92235.02c" == entries[0].ZAID() );
+
+        entries = xsdir.bracketingTemperatures( 92235, "c", 1e-8 );
+        CHECK( 1 == entries.size() );
+        CHECK( "92235.00c" == entries[0].ZAID() );
+
+        entries = xsdir.bracketingTemperatures( 92235, "c", 1e-7 );
+        CHECK( 1 == entries.size() );
+        CHECK( "92235.03c" == entries[0].ZAID() );
+
+        entries = xsdir.bracketingTemperatures( 92238, "c", 1e-7 );
+        CHECK( 1 == entries.size() );
+        CHECK( "92238.00c" == entries[0].ZAID() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the nearest temperature is requested" ) {
+
+      THEN( "the nearest entry is returned" ) {
+
+        CHECK( "92235.00c" == xsdir.nearestTemperature( 92235, "c", 3e-8 ).ZAID() );
+        CHECK( "92235.02c" == xsdir.nearestTemperature( 92235, "c", 5e-8 ).ZAID() );
+        CHECK( "92235.02c" == xsdir.nearestTemperature( 92235, "c", 5.1704e-8 ).ZAID() );
+        CHECK( "92235.03c" == xsdir.nearestTemperature( 92235, "c", 7e-8 ).ZAID() );
+        CHECK( "92235.00c" == xsdir.nearestTemperature( 92235, "c", 0. ).ZAID() );
+        CHECK( "92235.03c" == xsdir.nearestTemperature( 92235, "c", 1. ).ZAID() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "there are no entries with a temperature" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( xsdir.bracketingTemperatures( 92235, "p", 3e-8 ) );
+        CHECK_THROWS( xsdir.nearestTemperature( 92235, "p", 3e-8 ) );
+        CHECK_THROWS( xsdir.nearestTemperature( 94239, "c", 3e-8 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
 } // SCENARIO
 
 std::string chunk() {
@@ -302,6 +422,23 @@ void verifyChunk( const Xsdir& chunk ) {
 
   entry = chunk.entry( "92000.00p" );
   CHECK( "92000.00p" == entry.ZAID() );
+
+  auto entries = chunk.entries( 92235 );
+  CHECK( 1 == entries.size() );
+  CHECK( "92235.00c" == entries[0].ZAID() );
+
+  entries = chunk.entries( 92000, "p" );
+  CHECK( 1 == entries.size() );
+  CHECK( "92000.00p" == entries[0].ZAID() );
+
+  entries = chunk.entries( "c" );
+  CHECK( 2 == entries.size() );
+  CHECK( "92234.00c" == entries[0].ZAID() );
+  CHECK( "92235.00c" == entries[1].ZAID() );
+
+  CHECK( 0 == chunk.entries( 92000, "c" ).size() );
+  CHECK( 0 == chunk.entries( 1092235 ).size() );
+  CHECK( 0 == chunk.entries( "t" ).size() );
 }
 
 std::string chunkWithoutDatapath() {
@@ -359,3 +496,9 @@ void verifyChunkWithoutDatapath( const Xsdir& chunk ) {
   entry = chunk.entry( "92000.00p" );
   CHECK( "92000.00p" == entry.ZAID() );
 }
+
+void writeFile( const std::string& filename, const std::string& content ) {
+
+  std::ofstream out( filename, std::ios::binary );
+  out << content;
+}
@@ -0,0 +1,166 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/Xsdir.hpp"
+
+// other includes
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "ACEtk/toConcatenatedFile.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+Table chunk( const std::string&, double );
+void verifyChunk( const Table&, const std::string&, double );
+
+SCENARIO( "Xsdir::fromDirectory" ) {
+
+  GIVEN( "a directory with ACE files" ) {
+
+    std::filesystem::remove_all( "library" );
+    std::filesystem::create_directories( "library/neutron" );
+    toConcatenatedFile( { chunk( "1001.80c", 1. ), chunk( "1002.80c", 2. ),
+                          chunk( "1003.80c", 3. ) },
+                        "library/neutron/concatenated.ace" );
+    toConcatenatedFile( { chunk( "92235.80c", 4. ) },
+                        "library/neutron/92235.80c.ace" );
+    toConcatenatedFile( { chunk( "1001.81c", 5. ) }, "library/1001.81c.ace" );
+    {
+      std::ofstream out( "library/README" );
+      out << "this is not an ACE file\n";
+    }
+
+    // leftovers from writing a sidecar index that start with an ACE table
+    // but cannot be read completely
+    for ( const auto& name : { FileIndex::sidecar( "library/1001.81c.ace" ),
+                               FileIndex::temporarySidecar( "library/1001.81c.ace" ) } ) {
+
+      toConcatenatedFile( { chunk( "1002.81c", 6. ), chunk( "1003.81c", 7. ) }, name );
+      std::filesystem::resize_file( name, std::filesystem::file_size( name ) - 150 );
+    }
+
+    WHEN( "an xsdir is made for the directory" ) {
+
+      Xsdir xsdir = Xsdir::fromDirectory( "library" );
+      Xsdir sequential = Xsdir::fromDirectory( "library", 1 );
+
+      THEN( "the entries are ordered by file and by table" ) {
+
+        for ( const Xsdir* current : { &xsdir, &sequential } ) {
+
+          CHECK( "library" == current->dataPath().value() );
+
+          const auto& entries = current->entries();
+          CHECK( 5 == entries.size() );
+          CHECK( "1001.81c" == entries[0].ZAID() );
+          CHECK( "1001.81c.ace" == entries[0].fileName() );
+          CHECK( 1 == entries[0].address() );
+          CHECK( "92235.80c" == entries[1].ZAID() );
+          CHECK( "neutron/92235.80c.ace" == entries[1].fileName() );
+          CHECK( 1 == entries[1].address() );
+          CHECK( "1001.80c" == entries[2].ZAID() );
+          CHECK( "neutron/concatenated.ace" == entries[2].fileName() );
+          CHECK( 1 == entries[2].address() );
+          CHECK( "1002.80c" == entries[3].ZAID() );
+          CHECK( "neutron/concatenated.ace" == entries[3].fileName() );
+          CHECK( 15 == entries[3].address() );
+          CHECK( "1003.80c" == entries[4].ZAID() );
+          CHECK( "neutron/concatenated.ace" == entries[4].fileName() );
+          CHECK( 29 == entries[4].address() );
+
+          for ( const auto& entry : entries ) {
+
+            CHECK( 1 == entry.fileType() );
+            CHECK( 6 == entry.tableLength() );
+            CHECK( true == entry.ptable() );
+            CHECK_THAT( 236.0058, WithinRel( entry.AWR() ) );
+            CHECK_THAT( 2.5301e-8, WithinRel( entry.temperature().value() ) );
+          }
+
+          CHECK( 4 == current->atomicWeightRatios().size() );
+          CHECK_THAT( 236.0058, WithinRel( current->atomicWeightRatio( 1001 ) ) );
+          CHECK_THAT( 236.0058, WithinRel( current->atomicWeightRatio( 92235 ) ) );
+        }
+      } // THEN
+
+      THEN( "the tables can be loaded" ) {
+
+        verifyChunk( xsdir.load( "1001.80c" ), "1001.80c", 1. );
+        verifyChunk( xsdir.load( "1003.80c" ), "1003.80c", 3. );
+        verifyChunk( xsdir.load( "92235.80c" ), "92235.80c", 4. );
+        verifyChunk( xsdir.load( "1001.81c" ), "1001.81c", 5. );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    WHEN( "a file starts with an ACE table but cannot be read completely" ) {
+
+      std::filesystem::remove_all( "invalid" );
+      std::filesystem::create_directories( "invalid" );
+      toConcatenatedFile( { chunk( "1001.80c", 1. ) }, "invalid/valid.ace" );
+      toConcatenatedFile( { chunk( "1001.80c", 1. ), chunk( "1002.80c", 2. ) },
+                          "invalid/truncated.ace" );
+      std::filesystem::resize_file( "invalid/truncated.ace",
+                                    std::filesystem::file_size( "invalid/truncated.ace" ) - 150 );
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( Xsdir::fromDirectory( "invalid" ) );
+        CHECK_THROWS( Xsdir::fromDirectory( "invalid", 1 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the directory does not exist" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( Xsdir::fromDirectory( "not-a-directory" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+Table chunk( const std::string& zaid, double value ) {
+
+  std::ostringstream out;
+  out << std::string( 10 - std::min< std::size_t >( 10, zaid.size() ), ' ' )
+      << zaid << "  236.005800  2.5301E-08   12/13/12\n"
+      << "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+      << "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+      << "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+      << "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+      << "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+      << "        6    33074     1595      132       46      814        2        0\n"
+      << "        0        0        0        0        0        0        0        9\n"
+      << "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+      << "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+      << "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+      << "  1465934  1465976  1465982        0        0        0        0        8\n"
+      << "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+      << "  1.125000000000E+00";
+  char field[32];
+  std::snprintf( field, sizeof( field ), "%20.12E\n", value );
+  out << field;
+
+  std::string string = out.str();
+  return Table( State< std::string::const_iterator >{ 1, string.cbegin(), string.cend() } );
+}
+
+void verifyChunk( const Table& chunk, const std::string& zaid, double value ) {
+
+  CHECK( zaid == std::get< Table::Header >( chunk.header() ).ZAID() );
+  CHECK( 6 == chunk.data().NXS(1) );
+  CHECK( 33074 == chunk.data().NXS(2) );
+  CHECK( 1 == chunk.data().JXS(1) );
+  CHECK( 8 == chunk.data().JXS(32) );
+  CHECK( 6 == chunk.data().XSS().size() );
+  CHECK_THAT( 1.00000000000E+00, WithinRel( chunk.data().XSS(1) ) );
+  CHECK_THAT( value, WithinRel( chunk.data().XSS(6) ) );
+}
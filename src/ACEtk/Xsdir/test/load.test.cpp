@@ -0,0 +1,241 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/Xsdir.hpp"
+
+// other includes
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <sstream>
+#include "ACEtk/toConcatenatedFile.hpp"
+#include "ACEtk/fromBinaryFile.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+Table chunk( const std::string&, double );
+void verifyChunk( const Table&, const std::string&, double );
+
+SCENARIO( "Xsdir::load" ) {
+
+  GIVEN( "an xsdir for a concatenated file in a data path" ) {
+
+    std::filesystem::create_directories( "data" );
+    std::vector< Table > tables;
+    for ( unsigned int i = 0; i < 50; ++i ) {
+
+      tables.emplace_back( chunk( std::to_string( 1001 + i ) + ".80c", i + 1. ) );
+    }
+    auto entries = toConcatenatedFile( tables, "data/library.ace" );
+    for ( auto& entry : entries ) {
+
+      entry = XsdirEntry( entry.ZAID(), entry.AWR(), "library.ace",
+                          entry.address(), entry.tableLength(),
+                          entry.temperature() );
+    }
+    Xsdir xsdir( {}, entries, "data" );
+
+    WHEN( "tables are loaded" ) {
+
+      THEN( "the tables are read from the file at the right address" ) {
+
+        CHECK( "data/library.ace" == xsdir.filePath( xsdir.entry( "1001.80c" ) ) );
+
+        verifyChunk( xsdir.load( "1001.80c" ), "1001.80c", 1. );
+        verifyChunk( xsdir.load( "1050.80c" ), "1050.80c", 50. );
+        verifyChunk( xsdir.load( "1025.80c" ), "1025.80c", 25. );
+        verifyChunk( xsdir.load( xsdir.entry( "1026.80c" ) ), "1026.80c", 26. );
+      } // THEN
+
+      THEN( "copies of the xsdir can load tables" ) {
+
+        Xsdir copy = xsdir;
+        verifyChunk( xsdir.load( "1010.80c" ), "1010.80c", 10. );
+        verifyChunk( copy.load( "1011.80c" ), "1011.80c", 11. );
+      } // THEN
+
+      THEN( "tables can be loaded concurrently" ) {
+
+        std::vector< std::future< Table > > futures;
+        for ( unsigned int i = 0; i < 8; ++i ) {
+
+          futures.emplace_back(
+            std::async( std::launch::async,
+                        [&xsdir, i] { return xsdir.load( std::to_string( 1001 + 5 * i ) + ".80c" ); } ) );
+        }
+        for ( unsigned int i = 0; i < 8; ++i ) {
+
+          verifyChunk( futures[i].get(), std::to_string( 1001 + 5 * i ) + ".80c", 5. * i + 1. );
+        }
+      } // THEN
+    } // WHEN
+
+    WHEN( "the file is replaced after a table was loaded" ) {
+
+      verifyChunk( xsdir.load( "1003.80c" ), "1003.80c", 3. );
+      std::vector< Table > replaced( tables.begin() + 1, tables.end() );
+      replaced.insert( replaced.begin(), chunk( "1.80c", 0.5 ) );
+      toConcatenatedFile( replaced, "data/library.ace" );
+
+      THEN( "the index is rebuilt and the table is found" ) {
+
+        // the first table now has a shorter zaid so the offsets have changed
+        verifyChunk( xsdir.load( "1003.80c" ), "1003.80c", 3. );
+        verifyChunk( xsdir.load( "1050.80c" ), "1050.80c", 50. );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the file is rewritten with the same size after a table was loaded" ) {
+
+      // the file needs more lines than the stride of the line index
+      std::vector< Table > more( tables );
+      for ( unsigned int i = 50; i < 100; ++i ) {
+
+        more.emplace_back( chunk( std::to_string( 1001 + i ) + ".80c", i + 1. ) );
+      }
+      auto written = toConcatenatedFile( more, "data/rewritten.ace" );
+      for ( auto& entry : written ) {
+
+        entry = XsdirEntry( entry.ZAID(), entry.AWR(), "rewritten.ace",
+                            entry.address(), entry.tableLength(),
+                            entry.temperature() );
+      }
+      Xsdir rewritten( {}, written, "data" );
+
+      // trailing spaces on the last line of the first table shift the offsets
+      // of all other tables, the same spaces at the end of the file do not
+      auto rewrite = [&more] ( bool first ) {
+
+        toConcatenatedFile( more, "data/rewritten.ace" );
+        std::ifstream in( "data/rewritten.ace" );
+        std::string content( ( std::istreambuf_iterator< char >( in ) ),
+                             std::istreambuf_iterator< char >() );
+        in.close();
+
+        std::size_t end = 0;
+        for ( unsigned int line = 0; line < 14; ++line ) {
+
+          end = content.find( '\n', end ) + 1;
+        }
+        const auto position = first ? end - 1 : content.size() - 1;
+        content.insert( position, std::string( 8, ' ' ) );
+
+        std::ofstream out( "data/rewritten.ace", std::ios::binary );
+        out << content;
+      };
+
+      rewrite( false );
+      verifyChunk( rewritten.load( "1090.80c" ), "1090.80c", 90. );
+
+      rewrite( true );
+      const auto time = std::filesystem::last_write_time( "data/rewritten.ace" );
+      std::filesystem::last_write_time( "data/rewritten.ace",
+                                        time + std::chrono::seconds( 1 ) );
+
+      THEN( "the index is rebuilt and the table is found" ) {
+
+        verifyChunk( rewritten.load( "1090.80c" ), "1090.80c", 90. );
+        verifyChunk( rewritten.load( "1100.80c" ), "1100.80c", 100. );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an xsdir entry with an access route or an absolute file name" ) {
+
+    Xsdir xsdir( {}, { XsdirEntry( "1001.80c", 1., "file.ace", 1, 6,
+                                   std::nullopt, false, "route" ),
+                       XsdirEntry( "1002.80c", 1., "/absolute/file.ace", 1, 6 ),
+                       XsdirEntry( "1003.80c", 1., "file.ace", 1, 6 ) },
+                 "datapath" );
+    Xsdir nopath( {}, { XsdirEntry( "1003.80c", 1., "file.ace", 1, 6 ) } );
+
+    THEN( "the file path is resolved" ) {
+
+      CHECK( "route/file.ace" == xsdir.filePath( xsdir.entry( "1001.80c" ) ) );
+      CHECK( "/absolute/file.ace" == xsdir.filePath( xsdir.entry( "1002.80c" ) ) );
+      CHECK( "datapath/file.ace" == xsdir.filePath( xsdir.entry( "1003.80c" ) ) );
+      CHECK( "file.ace" == nopath.filePath( nopath.entry( "1003.80c" ) ) );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "an xsdir for a binary file" ) {
+
+    std::filesystem::create_directories( "data" );
+    toBinaryFile( chunk( "2004.80c", 2. ), "data/binary.ace" );
+    Xsdir xsdir( {}, { XsdirEntry( "2004.80c", 2., "binary.ace", 2, 1, 6,
+                                   std::nullopt, 4096, 512 ) },
+                 "data" );
+
+    THEN( "the table can be loaded" ) {
+
+      verifyChunk( xsdir.load( "2004.80c" ), "2004.80c", 2. );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    std::filesystem::create_directories( "data" );
+    toConcatenatedFile( { chunk( "1001.80c", 1. ), chunk( "1002.80c", 2. ) },
+                        "data/invalid.ace" );
+    Xsdir xsdir( {}, { XsdirEntry( "1001.80c", 1., "invalid.ace", 2, 6 ),
+                       XsdirEntry( "1002.80c", 1., "invalid.ace", 15, 7 ),
+                       XsdirEntry( "1003.80c", 1., "invalid.ace", 100, 6 ),
+                       XsdirEntry( "1004.80c", 1., "missing.ace", 1, 6 ),
+                       XsdirEntry( "1005.80c", 1., "invalid.ace", 3, 1, 6 ) },
+                 "data" );
+
+    THEN( "an exception is thrown" ) {
+
+      CHECK_THROWS( xsdir.load( "1000.80c" ) );
+      CHECK_THROWS( xsdir.load( "1001.80c" ) );
+      CHECK_THROWS( xsdir.load( "1002.80c" ) );
+      CHECK_THROWS( xsdir.load( "1003.80c" ) );
+      CHECK_THROWS( xsdir.load( "1004.80c" ) );
+      CHECK_THROWS( xsdir.load( "1005.80c" ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
+
+Table chunk( const std::string& zaid, double value ) {
+
+  std::ostringstream out;
+  out << std::string( 10 - std::min< std::size_t >( 10, zaid.size() ), ' ' )
+      << zaid << "  236.005800  2.5301E-08   12/13/12\n"
+      << "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+      << "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+      << "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+      << "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+      << "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+      << "        6    33074     1595      132       46      814        2        0\n"
+      << "        0        0        0        0        0        0        0        9\n"
+      << "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+      << "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+      << "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+      << "  1465934  1465976  1465982        0        0        0        0        8\n"
+      << "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+      << "  1.125000000000E+00";
+  char field[32];
+  std::snprintf( field, sizeof( field ), "%20.12E\n", value );
+  out << field;
+
+  std::string string = out.str();
+  return Table( State< std::string::const_iterator >{ 1, string.cbegin(), string.cend() } );
+}
+
+void verifyChunk( const Table& chunk, const std::string& zaid, double value ) {
+
+  CHECK( zaid == std::get< Table::Header >( chunk.header() ).ZAID() );
+  CHECK( 6 == chunk.data().NXS(1) );
+  CHECK( 33074 == chunk.data().NXS(2) );
+  CHECK( 1 == chunk.data().JXS(1) );
+  CHECK( 8 == chunk.data().JXS(32) );
+  CHECK( 6 == chunk.data().XSS().size() );
+  CHECK_THAT( 1.00000000000E+00, WithinRel( chunk.data().XSS(1) ) );
+  CHECK_THAT( value, WithinRel( chunk.data().XSS(6) ) );
+}
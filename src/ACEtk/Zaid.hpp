@@ -0,0 +1,126 @@
+#ifndef NJOY_ACETK_ZAID
+#define NJOY_ACETK_ZAID
+
+// system includes
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// other includes
+
+namespace njoy {
+namespace ACEtk {
+
+/**
+ *  @class
+ *  @brief A decoded ZAID (the identifier of an ACE table)
+ *
+ *  A ZAID like "92235.80c", "92235.710nc" or "1092235.80c" consists of a
+ *  number (the ZA or SZA value, where the isomeric state S is given by the
+ *  millions), a library number and a class, which is given by one or two
+ *  letters (e.g. c, nc, t or p). Thermal scattering ZAIDs like "h-h2o.40t"
+ *  have a name instead of a number: their ZA and isomeric state are zero.
+ *
+ *  The decoded ZAID can be packed into a single 64-bit key: ZAIDs with the
+ *  same key have the same number, library number (including the number of
+ *  digits) and class. Named ZAIDs are not distinguished by their name.
+ */
+class Zaid {
+
+  /* fields */
+  std::uint32_t za_ = 0;
+  std::uint32_t isomer_ = 0;
+  std::uint32_t library_ = 0;
+  std::uint32_t digits_ = 0;
+  std::array< char, 2 > class_ = {{ '\0', '\0' }};
+  bool numeric_ = false;
+
+public:
+
+  /* constructor */
+  #include "ACEtk/Zaid/src/ctor.hpp"
+
+  /**
+   *  @brief Return whether or not the ZAID starts with a ZA or SZA number
+   */
+  bool isNumeric() const { return this->numeric_; }
+
+  /**
+   *  @brief Return the ZA value (without the isomeric state)
+   */
+  std::uint32_t ZA() const { return this->za_; }
+
+  /**
+   *  @brief Return the isomeric state
+   */
+  std::uint32_t isomer() const { return this->isomer_; }
+
+  /**
+   *  @brief Return the SZA value (the number as given in the ZAID)
+   */
+  std::uint32_t SZA() const { return this->isomer_ * 1000000 + this->za_; }
+
+  /**
+   *  @brief Return the library number (e.g. 80 for 92235.80c)
+   */
+  std::uint32_t library() const { return this->library_; }
+
+  /**
+   *  @brief Return the class letters (e.g. c for 92235.80c)
+   */
+  std::string_view type() const {
+
+    return std::string_view( this->class_.data(),
+                             this->class_[1] ? 2 : this->class_[0] ? 1 : 0 );
+  }
+
+  /**
+   *  @brief Return the packed class letters
+   *
+   *  The class letters are packed in the lower 16 bits of the value.
+   */
+  std::uint32_t packedType() const { return pack( this->type() ); }
+
+  /**
+   *  @brief Pack class letters into a single value (case insensitive)
+   *
+   *  The class letters are packed in the lower 16 bits of the value. Only
+   *  the first two letters are taken into account.
+   *
+   *  @param[in] type   the class letters (e.g. c or nc)
+   */
+  static std::uint32_t pack( std::string_view type ) {
+
+    auto letter = [&type] ( std::size_t i ) -> std::uint32_t {
+
+      return i < type.size()
+             ? static_cast< unsigned char >(
+                   std::tolower( static_cast< unsigned char >( type[i] ) ) )
+             : 0;
+    };
+    return ( letter( 0 ) << 8 ) | letter( 1 );
+  }
+
+  /**
+   *  @brief Return the packed key of the ZAID
+   *
+   *  The key consists of the isomeric state (4 bits), the ZA value (20 bits),
+   *  the library number (12 bits), the number of digits in the library
+   *  number (4 bits) and the class letters (16 bits).
+   */
+  std::uint64_t key() const {
+
+    return ( static_cast< std::uint64_t >( this->isomer_ & 0xF ) << 52 ) |
+           ( static_cast< std::uint64_t >( this->za_ & 0xFFFFF ) << 32 ) |
+           ( static_cast< std::uint64_t >( this->library_ & 0xFFF ) << 20 ) |
+           ( static_cast< std::uint64_t >( this->digits_ & 0xF ) << 16 ) |
+           this->packedType();
+  }
+};
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,53 @@
+Zaid() = default;
+
+/**
+ *  @brief Constructor
+ *
+ *  A ZAID that cannot be decoded (e.g. a ZAID without a period) results in
+ *  a non-numeric ZAID without a library number or class.
+ *
+ *  @param[in] zaid   the ZAID
+ */
+Zaid( std::string_view zaid ) {
+
+  const auto period = zaid.rfind( '.' );
+  if ( period == std::string_view::npos ) {
+
+    return;
+  }
+
+  // the ZA or SZA number
+  const auto number = zaid.substr( 0, period );
+  if ( ( not number.empty() ) && ( number.size() <= 9 ) &&
+       ( number.find_first_not_of( "0123456789" ) == std::string_view::npos ) ) {
+
+    std::uint32_t value = 0;
+    for ( char c : number ) {
+
+      value = value * 10 + static_cast< std::uint32_t >( c - '0' );
+    }
+    this->numeric_ = true;
+    this->za_ = value % 1000000;
+    this->isomer_ = value / 1000000;
+  }
+
+  // the library number and class letters
+  auto suffix = zaid.substr( period + 1 );
+  std::size_t i = 0;
+  for ( ; ( i < suffix.size() ) &&
+          std::isdigit( static_cast< unsigned char >( suffix[i] ) ); ++i ) {
+
+    this->library_ = this->library_ * 10 +
+                     static_cast< std::uint32_t >( suffix[i] - '0' );
+  }
+  this->digits_ = i;
+  suffix = suffix.substr( i );
+  if ( suffix.size() <= 2 ) {
+
+    for ( std::size_t j = 0; j < suffix.size(); ++j ) {
+
+      this->class_[j] = static_cast< char >(
+                            std::tolower( static_cast< unsigned char >( suffix[j] ) ) );
+    }
+  }
+}
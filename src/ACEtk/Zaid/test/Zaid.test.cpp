@@ -0,0 +1,109 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ACEtk/Zaid.hpp"
+
+// other includes
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+SCENARIO( "Zaid" ) {
+
+  GIVEN( "valid ZAIDs" ) {
+
+    WHEN( "a ZAID with a ZA value is decoded" ) {
+
+      Zaid zaid( "92235.80c" );
+
+      THEN( "the ZAID is decoded correctly" ) {
+
+        CHECK( true == zaid.isNumeric() );
+        CHECK( 92235 == zaid.ZA() );
+        CHECK( 0 == zaid.isomer() );
+        CHECK( 92235 == zaid.SZA() );
+        CHECK( 80 == zaid.library() );
+        CHECK( "c" == zaid.type() );
+        CHECK( ( 'c' << 8 ) == zaid.packedType() );
+        CHECK( Zaid::pack( "c" ) == zaid.packedType() );
+        CHECK( Zaid::pack( "C" ) == zaid.packedType() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a ZAID with a two letter class is decoded" ) {
+
+      Zaid zaid( "92235.710NC" );
+
+      THEN( "the ZAID is decoded correctly" ) {
+
+        CHECK( true == zaid.isNumeric() );
+        CHECK( 92235 == zaid.ZA() );
+        CHECK( 0 == zaid.isomer() );
+        CHECK( 92235 == zaid.SZA() );
+        CHECK( 710 == zaid.library() );
+        CHECK( "nc" == zaid.type() );
+        CHECK( ( ( 'n' << 8 ) | 'c' ) == zaid.packedType() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a ZAID with an SZA value is decoded" ) {
+
+      Zaid zaid( "1095242.80c" );
+
+      THEN( "the ZAID is decoded correctly" ) {
+
+        CHECK( true == zaid.isNumeric() );
+        CHECK( 95242 == zaid.ZA() );
+        CHECK( 1 == zaid.isomer() );
+        CHECK( 1095242 == zaid.SZA() );
+        CHECK( 80 == zaid.library() );
+        CHECK( "c" == zaid.type() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a ZAID with a name is decoded" ) {
+
+      Zaid zaid( "h-h2o.40t" );
+
+      THEN( "the ZAID is decoded correctly" ) {
+
+        CHECK( false == zaid.isNumeric() );
+        CHECK( 0 == zaid.ZA() );
+        CHECK( 0 == zaid.isomer() );
+        CHECK( 40 == zaid.library() );
+        CHECK( "t" == zaid.type() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "keys are compared" ) {
+
+      THEN( "only equivalent ZAIDs have the same key" ) {
+
+        CHECK( Zaid( "92235.80c" ).key() == Zaid( "92235.80C" ).key() );
+        CHECK( Zaid( "92235.80c" ).key() != Zaid( "92235.80nc" ).key() );
+        CHECK( Zaid( "92235.80c" ).key() != Zaid( "92235.800c" ).key() );
+        CHECK( Zaid( "92235.80c" ).key() != Zaid( "92235.81c" ).key() );
+        CHECK( Zaid( "92235.80c" ).key() != Zaid( "92238.80c" ).key() );
+        CHECK( Zaid( "92235.80c" ).key() != Zaid( "1092235.80c" ).key() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid ZAIDs" ) {
+
+    WHEN( "a ZAID without a period is decoded" ) {
+
+      Zaid zaid( "abc" );
+
+      THEN( "nothing is decoded" ) {
+
+        CHECK( false == zaid.isNumeric() );
+        CHECK( 0 == zaid.ZA() );
+        CHECK( 0 == zaid.library() );
+        CHECK( "" == zaid.type() );
+        CHECK( 0 == zaid.key() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
@@ -29,27 +29,8 @@ protected:
 
 AngularDistributionBlock() = default;
 
-AngularDistributionBlock( const AngularDistributionBlock& base ) :
-  Base( base ), nr_( base.nr_ ), iterator_( base.iterator_ ),
-  data_( base.data_ ), zero_index_( base.zero_index_ ) {
-
-  if ( Base::owner() ) {
-
-    this->iterator_ = this->begin() + this->nr_ + ( this->zero_index_ ? 1 : 0 );
-    this->generateBlocks();
-  }
-}
-
-AngularDistributionBlock( AngularDistributionBlock&& base ) :
-  Base( std::move( base ) ), nr_( base.nr_ ), iterator_( base.iterator_ ),
-  data_( std::move( base.data_ ) ), zero_index_( base.zero_index_ ) {
-
-  if ( Base::owner() ) {
-
-    this->iterator_ = this->begin() + this->nr_ + ( this->zero_index_ ? 1 : 0 );
-    this->generateBlocks();
-  }
-}
+AngularDistributionBlock( const AngularDistributionBlock& ) = default;
+AngularDistributionBlock( AngularDistributionBlock&& ) = default;
 
 /**
  *  @brief Constructor for a block without a zero index
@@ -92,38 +73,5 @@ AngularDistributionBlock( std::string name,
   this->generateBlocks();
 }
 
-AngularDistributionBlock& operator=( const AngularDistributionBlock& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->nr_ = base.nr_;
-    this->iterator_ = base.iterator_;
-    this->data_ = base.data_;
-    this->zero_index_ = base.zero_index_;
-    if ( Base::owner() ) {
-
-      this->iterator_ = this->begin() + this->nr_ + ( this->zero_index_ ? 1 : 0 );
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-AngularDistributionBlock& operator=( AngularDistributionBlock&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->nr_ = base.nr_;
-    this->iterator_ = base.iterator_;
-    this->data_ = std::move( base.data_ );
-    this->zero_index_ = base.zero_index_;
-    if ( Base::owner() ) {
-
-      this->iterator_ = this->begin() + this->nr_ + ( this->zero_index_ ? 1 : 0 );
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+AngularDistributionBlock& operator=( const AngularDistributionBlock& ) = default;
+AngularDistributionBlock& operator=( AngularDistributionBlock&& ) = default;
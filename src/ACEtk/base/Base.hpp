@@ -2,6 +2,7 @@
 #define NJOY_ACETK_BASE_BASE
 
 // system includes
+#include <memory>
 #include <vector>
 #include <optional>
 
@@ -19,6 +20,11 @@ namespace base {
  *
  *  The Base class represents a block of data from the XSS array in the ACE
  *  tables, for example: the ESZ block for a continuous energy ACE file.
+ *
+ *  A block either refers to the XSS array of a table or owns its own XSS
+ *  array (when it was created from its components). An owned XSS array is
+ *  immutable and shared between copies of the block, so that copying a block
+ *  never copies its XSS array or regenerates the blocks it contains.
  */
 class Base {
 
@@ -30,7 +36,7 @@ private:
 
   /* fields */
   std::string name_;
-  std::optional< std::vector< double > > xss_;
+  std::shared_ptr< const std::vector< double > > xss_;
   Iterator begin_;
   Iterator end_;
   std::size_t length_;
@@ -38,7 +44,6 @@ private:
 protected:
 
   /* auxiliary functions */
-  #include "ACEtk/base/Base/src/generateData.hpp"
   #include "ACEtk/base/Base/src/verifyIndex.hpp"
   #include "ACEtk/base/Base/src/verifyReactionIndex.hpp"
 
@@ -16,27 +16,8 @@ protected:
 
 BlockWithLocators() = default;
 
-BlockWithLocators( const BlockWithLocators& base ) :
-  Base( base ), n_( base.n_ ), locator_( base.locator_ ),
-  iterator_( base.iterator_ ), data_( base.data_ ) {
-
-  if ( Base::owner() ) {
-
-    this->iterator_ = this->begin() + this->N();
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
-
-BlockWithLocators( BlockWithLocators&& base ) :
-  Base( std::move( base ) ), n_( base.n_ ), locator_( base.locator_ ),
-  iterator_( base.iterator_ ), data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->iterator_ = this->begin() + this->N();
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
+BlockWithLocators( const BlockWithLocators& ) = default;
+BlockWithLocators( BlockWithLocators&& ) = default;
 
 /**
  *  @brief Constructor for a block
@@ -70,38 +51,5 @@ BlockWithLocators( std::string name,
   static_cast< Derived* >( this )->generateBlocks();
 }
 
-BlockWithLocators& operator=( const BlockWithLocators& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->n_ = base.n_;
-    this->locator_ = base.locator_;
-    this->iterator_ = base.iterator_;
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->iterator_ = this->begin() + this->N();
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-BlockWithLocators& operator=( BlockWithLocators&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->n_ = base.n_;
-    this->locator_ = base.locator_;
-    this->iterator_ = base.iterator_;
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->iterator_ = this->begin() + this->N();
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
+BlockWithLocators& operator=( const BlockWithLocators& ) = default;
+BlockWithLocators& operator=( BlockWithLocators&& ) = default;
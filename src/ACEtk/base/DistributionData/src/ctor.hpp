@@ -1,28 +1,7 @@
 DistributionData() = default;
 
-DistributionData( const DistributionData& base ) :
-  Base( base ), locb_( base.locb_ ),
-  interpolation_( base.interpolation_ ),
-  values_( base.values_ ),
-  distributions_( base.distributions_ ) {
-
-  if ( Base::owner() ) {
-
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
-
-DistributionData( DistributionData&& base ) :
-  Base( std::move( base ) ), locb_( base.locb_ ),
-  interpolation_( std::move( base.interpolation_ ) ),
-  values_( std::move( base.values_ ) ),
-  distributions_( std::move( base.distributions_ ) ) {
-
-  if ( Base::owner() ) {
-
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
+DistributionData( const DistributionData& ) = default;
+DistributionData( DistributionData&& ) = default;
 
 /**
  *  @brief Constructor
@@ -65,36 +44,5 @@ DistributionData( std::string name, std::size_t locb,
   static_cast< Derived* >( this )->generateBlocks();
 }
 
-DistributionData& operator=( const DistributionData& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->interpolation_ = base.interpolation_;
-    this->values_ = base.values_;
-    this->distributions_ = base.distributions_;
-    this->locb_ = base.locb_;
-    if ( Base::owner() ) {
-
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-DistributionData& operator=( DistributionData&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->interpolation_ = std::move( base.interpolation_ );
-    this->values_ = std::move( base.values_ );
-    this->distributions_ = std::move( base.distributions_ );
-    this->locb_ = base.locb_;
-    if ( Base::owner() ) {
-
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
+DistributionData& operator=( const DistributionData& ) = default;
+DistributionData& operator=( DistributionData&& ) = default;
@@ -1,26 +1,7 @@
 DistributionDataWithInterpolationType() = default;
 
-DistributionDataWithInterpolationType( const DistributionDataWithInterpolationType& base ) :
-  Base( base ), locb_( base.locb_ ),
-  values_( base.values_ ),
-  distributions_( base.distributions_ ) {
-
-  if ( Base::owner() ) {
-
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
-
-DistributionDataWithInterpolationType( DistributionDataWithInterpolationType&& base ) :
-  Base( std::move( base ) ), locb_( base.locb_ ),
-  values_( std::move( base.values_ ) ),
-  distributions_( std::move( base.distributions_ ) ) {
-
-  if ( Base::owner() ) {
-
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
+DistributionDataWithInterpolationType( const DistributionDataWithInterpolationType& ) = default;
+DistributionDataWithInterpolationType( DistributionDataWithInterpolationType&& ) = default;
 
 /**
  *  @brief Constructor
@@ -60,34 +41,5 @@ DistributionDataWithInterpolationType( std::string&& name,
   static_cast< Derived* >( this )->generateBlocks();
 }
 
-DistributionDataWithInterpolationType& operator=( const DistributionDataWithInterpolationType& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->locb_ = base.locb_;
-    this->values_ = base.values_;
-    this->distributions_ = base.distributions_;
-    if ( Base::owner() ) {
-
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-DistributionDataWithInterpolationType& operator=( DistributionDataWithInterpolationType&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->locb_ = base.locb_;
-    this->values_ = std::move( base.values_ );
-    this->distributions_ = std::move( base.distributions_ );
-    if ( Base::owner() ) {
-
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
+DistributionDataWithInterpolationType& operator=( const DistributionDataWithInterpolationType& ) = default;
+DistributionDataWithInterpolationType& operator=( DistributionDataWithInterpolationType&& ) = default;
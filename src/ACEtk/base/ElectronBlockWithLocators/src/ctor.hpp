@@ -14,25 +14,8 @@ protected:
 
 ElectronBlockWithLocators() = default;
 
-ElectronBlockWithLocators( const ElectronBlockWithLocators& base ) :
-  Base( base ), n_( base.n_ ), information_( base.information_ ),
-  data_( base.data_ ) {
-
-  if ( Base::owner() ) {
-
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
-
-ElectronBlockWithLocators( ElectronBlockWithLocators&& base ) :
-  Base( std::move( base ) ), n_( base.n_ ),
-  information_( std::move( base.information_ ) ), data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    static_cast< Derived* >( this )->generateBlocks();
-  }
-}
+ElectronBlockWithLocators( const ElectronBlockWithLocators& ) = default;
+ElectronBlockWithLocators( ElectronBlockWithLocators&& ) = default;
 
 /**
  *  @brief Constructor for a block
@@ -58,34 +41,5 @@ ElectronBlockWithLocators( std::string name, Iterator begin, Iterator end,
   static_cast< Derived* >( this )->generateBlocks();
 }
 
-ElectronBlockWithLocators& operator=( const ElectronBlockWithLocators& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->n_ = base.n_;
-    this->information_ = base.information_;
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-ElectronBlockWithLocators& operator=( ElectronBlockWithLocators&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->n_ = base.n_;
-    this->information_ = std::move( base.information_ );
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      static_cast< Derived* >( this )->generateBlocks();
-    }
-  }
-  return *this;
-}
+ElectronBlockWithLocators& operator=( const ElectronBlockWithLocators& ) = default;
+ElectronBlockWithLocators& operator=( ElectronBlockWithLocators&& ) = default;
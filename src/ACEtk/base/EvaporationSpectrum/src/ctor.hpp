@@ -1,24 +1,7 @@
 EvaporationSpectrum() = default;
 
-EvaporationSpectrum( const EvaporationSpectrum& base ) :
-  Base( base ), tabulated_( base.tabulated_ ),
-  type_( base.type_ ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-EvaporationSpectrum( EvaporationSpectrum&& base ) :
-  Base( std::move( base ) ), tabulated_( std::move( base.tabulated_ ) ),
-  type_( base.type_ ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
+EvaporationSpectrum( const EvaporationSpectrum& ) = default;
+EvaporationSpectrum( EvaporationSpectrum&& ) = default;
 
 /**
  *  @brief Constructor
@@ -62,32 +45,5 @@ EvaporationSpectrum( std::string name, EnergyDistributionType type,
   this->generateBlocks();
 }
 
-EvaporationSpectrum& operator=( const EvaporationSpectrum& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->tabulated_ = base.tabulated_;
-    this->type_ = base.type_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-EvaporationSpectrum& operator=( EvaporationSpectrum&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->tabulated_ = std::move( base.tabulated_ );
-    this->type_ = base.type_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+EvaporationSpectrum& operator=( const EvaporationSpectrum& ) = default;
+EvaporationSpectrum& operator=( EvaporationSpectrum&& ) = default;
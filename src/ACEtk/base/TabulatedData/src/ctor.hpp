@@ -1,24 +1,7 @@
 TabulatedData() = default;
 
-TabulatedData( const TabulatedData& base ) :
-  Base( base ), interpolation_( base.interpolation_ ),
-  data_( base.data_ ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-TabulatedData( TabulatedData&& base ) :
-  Base( std::move( base ) ), interpolation_( std::move( base.interpolation_ ) ),
-  data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
+TabulatedData( const TabulatedData& ) = default;
+TabulatedData( TabulatedData&& ) = default;
 
 /**
  *  @brief Constructor
@@ -56,32 +39,5 @@ TabulatedData( std::string name, Iterator begin, Iterator end ) :
   this->generateBlocks();
 }
 
-TabulatedData& operator=( const TabulatedData& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->interpolation_ = base.interpolation_;
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-TabulatedData& operator=( TabulatedData&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->interpolation_ = std::move( base.interpolation_ );
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+TabulatedData& operator=( const TabulatedData& ) = default;
+TabulatedData& operator=( TabulatedData&& ) = default;
@@ -1,58 +1,10 @@
 AngularDistributionData() = default;
 
-AngularDistributionData( const AngularDistributionData& base ) :
-  Base( base ), locb_( base.locb_ ),
-  values_( base.values_ ),
-  distributions_( base.distributions_ ) {
+AngularDistributionData( const AngularDistributionData& ) = default;
+AngularDistributionData( AngularDistributionData&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-AngularDistributionData( AngularDistributionData&& base ) :
-  Base( std::move( base ) ), locb_( base.locb_ ),
-  values_( std::move( base.values_ ) ),
-  distributions_( std::move( base.distributions_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-AngularDistributionData& operator=( const AngularDistributionData& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->locb_ = base.locb_;
-    this->values_ = base.values_;
-    this->distributions_ = base.distributions_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-AngularDistributionData& operator=( AngularDistributionData&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->locb_ = base.locb_;
-    this->values_ = std::move( base.values_ );
-    this->distributions_ = std::move( base.distributions_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+AngularDistributionData& operator=( const AngularDistributionData& ) = default;
+AngularDistributionData& operator=( AngularDistributionData&& ) = default;
 
 /**
  *  @brief Constructor
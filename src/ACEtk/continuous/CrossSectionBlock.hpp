@@ -135,6 +135,8 @@ public:
     return this->crossSectionData( index ).crossSections();
   }
 
+  #include "ACEtk/continuous/CrossSectionBlock/src/evaluate.hpp"
+
   using BlockWithLocators::empty;
   using BlockWithLocators::name;
   using BlockWithLocators::length;
@@ -0,0 +1,52 @@
+/**
+ *  @brief Evaluate the cross sections of all reactions in an interval of the
+ *         energy grid
+ *
+ *  The values are given in the order of the reaction numbers in the MTR
+ *  block (see CrossSectionData::evaluate).
+ *
+ *  @param[in]  interval   the interval on the ESZ energy grid (zero-based)
+ *  @param[in]  fraction   the interpolation fraction in the interval
+ *  @param[out] values     the cross section values (NTR values)
+ */
+void evaluate( std::size_t interval, double fraction, double* values ) const {
+
+  for ( const auto& data : this->data() ) {
+
+    *values++ = data.evaluate( interval, fraction );
+  }
+}
+
+/**
+ *  @brief Evaluate the cross sections of all reactions for a batch of
+ *         locations on the energy grid
+ *
+ *  The values for each reaction are stored contiguously (in the order of
+ *  the reaction numbers in the MTR block) with the values of reaction i
+ *  (one-based) starting at values + ( i - 1 ) * stride.
+ *
+ *  @param[in]  intervals   the intervals on the ESZ energy grid (zero-based)
+ *  @param[in]  fractions   the interpolation fractions in the intervals
+ *  @param[in]  size        the number of locations
+ *  @param[out] values      the cross section values
+ *  @param[in]  stride      the distance between the values of two reactions
+ */
+void evaluate( const std::size_t* intervals, const double* fractions,
+               std::size_t size, double* values, std::size_t stride ) const {
+
+  for ( const auto& data : this->data() ) {
+
+    const std::size_t first = data.energyIndex() - 1;
+    const std::size_t number = data.numberValues();
+    const auto xs = data.crossSections();
+    for ( std::size_t i = 0; i < size; ++i ) {
+
+      const std::size_t interval = intervals[i];
+      const std::size_t index = interval - first;
+      values[i] = ( interval >= first ) && ( index + 1 < number )
+                  ? xs[ index ] + fractions[i] * ( xs[ index + 1 ] - xs[ index ] )
+                  : data.evaluate( interval, fractions[i] );
+    }
+    values += stride;
+  }
+}
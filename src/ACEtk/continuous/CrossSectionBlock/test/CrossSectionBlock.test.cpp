@@ -116,6 +116,34 @@ SCENARIO( "CrossSectionBlock" ) {
       } // THEN
     } // WHEN
 
+    WHEN( "a CrossSectionBlock that owns its data is copied" ) {
+
+      CrossSectionBlock chunk( xss.begin(), xss.begin() + 3, xss.end(), 3 );
+      std::vector< CrossSectionData > xs;
+      for ( std::size_t index = 1; index <= chunk.NTR(); ++index ) {
+
+        auto values = chunk.crossSections( index );
+        xs.emplace_back( chunk.energyIndex( index ),
+                         std::vector< double >( values.begin(), values.end() ) );
+      }
+      CrossSectionBlock owner( std::move( xs ) );
+      CrossSectionBlock copy( owner );
+      CrossSectionBlock assigned = makeDummyBlock();
+      assigned = owner;
+
+      THEN( "the xss array is shared and not copied" ) {
+
+        CHECK( owner.crossSectionData( 1 ).begin() ==
+               copy.crossSectionData( 1 ).begin() );
+        CHECK( owner.crossSectionData( 1 ).begin() ==
+               assigned.crossSectionData( 1 ).begin() );
+        CHECK( owner.crossSectionData( 2 ).begin() ==
+               copy.crossSectionData( 2 ).begin() );
+        verifyChunk( copy, xss );
+        verifyChunk( assigned, xss );
+      } // THEN
+    } // WHEN
+
     WHEN( "the data is defined by iterators" ) {
 
       CrossSectionBlock chunk( xss.begin(), xss.begin() + 3, xss.end(), 3 );
@@ -176,6 +204,48 @@ SCENARIO( "CrossSectionBlock" ) {
       } // THEN
     } // WHEN
   } // GIVEN
+
+  GIVEN( "a CrossSectionBlock instance with a threshold reaction" ) {
+
+    // an energy grid with 4 points, the second reaction starts at point 3
+    CrossSectionBlock chunk( { CrossSectionData( 1, { 1., 2., 3., 4. } ),
+                               CrossSectionData( 3, { 0., 2. } ) } );
+
+    WHEN( "the cross sections are evaluated at a single location" ) {
+
+      THEN( "the cross sections of all reactions are interpolated" ) {
+
+        double values[2];
+        chunk.evaluate( 1, 0.5, values );
+        CHECK_THAT( 2.5, WithinRel( values[0] ) );
+        CHECK( 0. == values[1] );
+
+        chunk.evaluate( 2, 0.5, values );
+        CHECK_THAT( 3.5, WithinRel( values[0] ) );
+        CHECK_THAT( 1., WithinRel( values[1] ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the cross sections are evaluated for a batch of locations" ) {
+
+      THEN( "the cross sections of all reactions are interpolated" ) {
+
+        std::size_t intervals[3] = { 0, 1, 2 };
+        double fractions[3] = { 0.5, 0.5, 1. };
+        std::vector< double > values( 8, -1. );
+        chunk.evaluate( intervals, fractions, 3, values.data(), 4 );
+
+        CHECK_THAT( 1.5, WithinRel( values[0] ) );
+        CHECK_THAT( 2.5, WithinRel( values[1] ) );
+        CHECK_THAT( 4., WithinRel( values[2] ) );
+        CHECK( -1. == values[3] );
+        CHECK( 0. == values[4] );
+        CHECK( 0. == values[5] );
+        CHECK_THAT( 2., WithinRel( values[6] ) );
+        CHECK( -1. == values[7] );
+      } // THEN
+    } // WHEN
+  } // GIVEN
 } // SCENARIO
 
 std::vector< double > chunk() {
@@ -46,6 +46,35 @@ public:
    */
   auto crossSections() const { return this->XSS( 3, this->numberValues() ); }
 
+  /**
+   *  @brief Return the cross section value in an interval of the energy grid
+   *
+   *  The cross section is interpolated linearly in the interval of the energy
+   *  grid (lin-lin interpolation). Below the first energy point of the
+   *  reaction (the threshold) and above its last energy point, the cross
+   *  section is zero.
+   *
+   *  @param[in] interval   the interval on the ESZ energy grid (zero-based)
+   *  @param[in] fraction   the interpolation fraction in the interval
+   */
+  double evaluate( std::size_t interval, double fraction ) const {
+
+    const std::size_t first = this->energyIndex() - 1;
+    const std::size_t number = this->numberValues();
+    if ( interval < first ) {
+
+      return 0.;
+    }
+
+    const auto values = this->begin() + 2;
+    const std::size_t index = interval - first;
+    if ( index + 1 < number ) {
+
+      return values[ index ] + fraction * ( values[ index + 1 ] - values[ index ] );
+    }
+    return ( index + 1 == number ) && ( fraction == 0. ) ? values[ index ] : 0.;
+  }
+
   using Base::empty;
   using Base::name;
   using Base::length;
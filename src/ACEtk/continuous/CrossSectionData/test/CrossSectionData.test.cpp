@@ -122,6 +122,28 @@ SCENARIO( "CrossSectionData" ) {
       } // THEN
     } // WHEN
   } // GIVEN
+
+  GIVEN( "a CrossSectionData instance for a threshold reaction" ) {
+
+    // defined on the energy points 3, 4 and 5 (one-based) of the energy grid
+    CrossSectionData chunk( 3, { 0., 2., 4. } );
+
+    WHEN( "the cross section is evaluated in an interval of the energy grid" ) {
+
+      THEN( "the cross section is interpolated or zero" ) {
+
+        CHECK( 0. == chunk.evaluate( 0, 0.5 ) );
+        CHECK( 0. == chunk.evaluate( 1, 0.5 ) );
+        CHECK_THAT( 0., WithinRel( chunk.evaluate( 2, 0. ) ) );
+        CHECK_THAT( 1., WithinRel( chunk.evaluate( 2, 0.5 ) ) );
+        CHECK_THAT( 2.5, WithinRel( chunk.evaluate( 3, 0.25 ) ) );
+        CHECK_THAT( 4., WithinRel( chunk.evaluate( 3, 1. ) ) );
+        CHECK_THAT( 4., WithinRel( chunk.evaluate( 4, 0. ) ) );
+        CHECK( 0. == chunk.evaluate( 4, 0.5 ) );
+        CHECK( 0. == chunk.evaluate( 5, 0. ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
 } // SCENARIO
 
 std::vector< double > chunk() {
@@ -15,55 +15,11 @@ public:
 
 DelayedNeutronPrecursorBlock() = default;
 
-DelayedNeutronPrecursorBlock( const DelayedNeutronPrecursorBlock& base ) :
-  Base( base ), npcr_( base.npcr_ ),
-  data_( base.data_ ) {
+DelayedNeutronPrecursorBlock( const DelayedNeutronPrecursorBlock& ) = default;
+DelayedNeutronPrecursorBlock( DelayedNeutronPrecursorBlock&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-DelayedNeutronPrecursorBlock( DelayedNeutronPrecursorBlock&& base ) :
-  Base( std::move( base ) ), npcr_( base.npcr_ ),
-  data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-DelayedNeutronPrecursorBlock& operator=( const DelayedNeutronPrecursorBlock& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->npcr_ = base.npcr_;
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-DelayedNeutronPrecursorBlock& operator=( DelayedNeutronPrecursorBlock&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->npcr_ = base.npcr_;
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+DelayedNeutronPrecursorBlock& operator=( const DelayedNeutronPrecursorBlock& ) = default;
+DelayedNeutronPrecursorBlock& operator=( DelayedNeutronPrecursorBlock&& ) = default;
 
 /**
  *  @brief Constructor
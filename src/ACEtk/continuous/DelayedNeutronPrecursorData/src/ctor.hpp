@@ -1,54 +1,10 @@
 DelayedNeutronPrecursorData() = default;
 
-DelayedNeutronPrecursorData( const DelayedNeutronPrecursorData& base ) :
-  Base( base ), number_( base.number_ ),
-  data_( base.data_ ) {
+DelayedNeutronPrecursorData( const DelayedNeutronPrecursorData& ) = default;
+DelayedNeutronPrecursorData( DelayedNeutronPrecursorData&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-DelayedNeutronPrecursorData( DelayedNeutronPrecursorData&& base ) :
-  Base( std::move( base ) ), number_( base.number_ ),
-  data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-DelayedNeutronPrecursorData& operator=( const DelayedNeutronPrecursorData& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->number_ = base.number_;
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-DelayedNeutronPrecursorData& operator=( DelayedNeutronPrecursorData&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->number_ = base.number_;
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+DelayedNeutronPrecursorData& operator=( const DelayedNeutronPrecursorData& ) = default;
+DelayedNeutronPrecursorData& operator=( DelayedNeutronPrecursorData&& ) = default;
 
 /**
  *  @brief Constructor
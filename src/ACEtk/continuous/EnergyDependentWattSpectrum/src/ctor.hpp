@@ -1,54 +1,10 @@
 EnergyDependentWattSpectrum() = default;
 
-EnergyDependentWattSpectrum( const EnergyDependentWattSpectrum& base ) :
-  Base( base ), a_( base.a_ ), b_( base.b_ ) {
+EnergyDependentWattSpectrum( const EnergyDependentWattSpectrum& ) = default;
+EnergyDependentWattSpectrum( EnergyDependentWattSpectrum&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-EnergyDependentWattSpectrum( EnergyDependentWattSpectrum&& base ) :
-  Base( std::move( base ) ),
-  a_( std::move( base.a_ ) ),
-  b_( std::move( base.b_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-EnergyDependentWattSpectrum& operator=( const EnergyDependentWattSpectrum& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->a_ = base.a_;
-    this->b_ = base.b_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-EnergyDependentWattSpectrum& operator=( EnergyDependentWattSpectrum&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->a_ = std::move( base.a_ );
-    this->b_ = std::move( base.b_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+EnergyDependentWattSpectrum& operator=( const EnergyDependentWattSpectrum& ) = default;
+EnergyDependentWattSpectrum& operator=( EnergyDependentWattSpectrum&& ) = default;
 
 /**
  *  @brief Constructor
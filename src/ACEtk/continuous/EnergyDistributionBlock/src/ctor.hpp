@@ -30,69 +30,11 @@ public:
 
 EnergyDistributionBlock() = default;
 
-EnergyDistributionBlock( const EnergyDistributionBlock& base ) :
-  Base( base ), nr_( base.nr_ ), iterator_( base.iterator_ ),
-  tyr_( base.tyr_ ),
-  data_( base.data_ ),
-  multiplicities_( base.multiplicities_ ),
-  frames_( base.frames_ ) {
+EnergyDistributionBlock( const EnergyDistributionBlock& ) = default;
+EnergyDistributionBlock( EnergyDistributionBlock&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-EnergyDistributionBlock( EnergyDistributionBlock&& base ) :
-  Base( std::move( base ) ), nr_( base.nr_ ), iterator_( base.iterator_ ),
-  tyr_( std::move( base.tyr_ ) ),
-  data_( std::move( base.data_ ) ),
-  multiplicities_( std::move( base.multiplicities_ ) ),
-  frames_( std::move( base.frames_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-EnergyDistributionBlock& operator=( const EnergyDistributionBlock& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->nr_ = base.nr_;
-    this->iterator_ = base.iterator_;
-    this->tyr_ = base.tyr_;
-    this->data_ = base.data_;
-    this->multiplicities_ = base.multiplicities_;
-    this->frames_ = base.frames_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-EnergyDistributionBlock& operator=( EnergyDistributionBlock&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->nr_ = base.nr_;
-    this->iterator_ = base.iterator_;
-    this->tyr_ = std::move( base.tyr_ );
-    this->data_ = std::move( base.data_ );
-    this->multiplicities_ = std::move( base.multiplicities_ );
-    this->frames_ = std::move( base.frames_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+EnergyDistributionBlock& operator=( const EnergyDistributionBlock& ) = default;
+EnergyDistributionBlock& operator=( EnergyDistributionBlock&& ) = default;
 
 /**
  *  @brief Constructor
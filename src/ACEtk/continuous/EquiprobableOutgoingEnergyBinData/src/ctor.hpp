@@ -1,58 +1,10 @@
 EquiprobableOutgoingEnergyBinData() = default;
 
-EquiprobableOutgoingEnergyBinData( const EquiprobableOutgoingEnergyBinData& base ) :
-  Base( base ), interpolation_( base.interpolation_ ),
-  energies_( base.energies_ ),
-  bins_( base.bins_ ) {
+EquiprobableOutgoingEnergyBinData( const EquiprobableOutgoingEnergyBinData& ) = default;
+EquiprobableOutgoingEnergyBinData( EquiprobableOutgoingEnergyBinData&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-EquiprobableOutgoingEnergyBinData( EquiprobableOutgoingEnergyBinData&& base ) :
-  Base( std::move( base ) ), interpolation_( std::move( base.interpolation_ ) ),
-  energies_( std::move( base.energies_ ) ),
-  bins_( std::move( base.bins_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-EquiprobableOutgoingEnergyBinData& operator=( const EquiprobableOutgoingEnergyBinData& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->interpolation_ = base.interpolation_;
-    this->energies_ = base.energies_;
-    this->bins_ = base.bins_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-EquiprobableOutgoingEnergyBinData& operator=( EquiprobableOutgoingEnergyBinData&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->interpolation_ = std::move( base.interpolation_ );
-    this->energies_ = std::move( base.energies_ );
-    this->bins_ = std::move( base.bins_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+EquiprobableOutgoingEnergyBinData& operator=( const EquiprobableOutgoingEnergyBinData& ) = default;
+EquiprobableOutgoingEnergyBinData& operator=( EquiprobableOutgoingEnergyBinData&& ) = default;
 
 /**
  *  @brief Constructor
@@ -1,54 +1,10 @@
 FissionMultiplicityBlock() = default;
 
-FissionMultiplicityBlock( const FissionMultiplicityBlock& base ) :
-  Base( base ),
-  prompt_( base.prompt_ ), total_( base.total_ ) {
+FissionMultiplicityBlock( const FissionMultiplicityBlock& ) = default;
+FissionMultiplicityBlock( FissionMultiplicityBlock&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-FissionMultiplicityBlock( FissionMultiplicityBlock&& base ) :
-  Base( base ),
-  prompt_( std::move( base.prompt_ ) ), total_( std::move( base.total_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-FissionMultiplicityBlock& operator=( const FissionMultiplicityBlock& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->prompt_ = base.prompt_;
-    this->total_ = base.total_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-FissionMultiplicityBlock& operator=( FissionMultiplicityBlock&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->prompt_ = std::move( base.prompt_ );
-    this->total_ = std::move( base.total_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+FissionMultiplicityBlock& operator=( const FissionMultiplicityBlock& ) = default;
+FissionMultiplicityBlock& operator=( FissionMultiplicityBlock&& ) = default;
 
 /**
  *  @brief Constructor
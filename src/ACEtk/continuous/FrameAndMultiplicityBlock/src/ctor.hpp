@@ -26,59 +26,11 @@ public:
 
 FrameAndMultiplicityBlock() = default;
 
-FrameAndMultiplicityBlock( const FrameAndMultiplicityBlock& base ) :
-  Base( base ), ntr_( base.ntr_ ),
-  frames_( base.frames_ ),
-  multiplicities_( base.multiplicities_ ) {
+FrameAndMultiplicityBlock( const FrameAndMultiplicityBlock& ) = default;
+FrameAndMultiplicityBlock( FrameAndMultiplicityBlock&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-FrameAndMultiplicityBlock( FrameAndMultiplicityBlock&& base ) :
-  Base( std::move( base ) ), ntr_( base.ntr_ ),
-  frames_( std::move( base.frames_ ) ),
-  multiplicities_( std::move( base.multiplicities_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-FrameAndMultiplicityBlock& operator=( const FrameAndMultiplicityBlock& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->ntr_ = base.ntr_;
-    this->frames_ = base.frames_;
-    this->multiplicities_ = base.multiplicities_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-FrameAndMultiplicityBlock& operator=( FrameAndMultiplicityBlock&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->ntr_ = base.ntr_;
-    this->frames_ = std::move( base.frames_ );
-    this->multiplicities_ = std::move( base.multiplicities_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+FrameAndMultiplicityBlock& operator=( const FrameAndMultiplicityBlock& ) = default;
+FrameAndMultiplicityBlock& operator=( FrameAndMultiplicityBlock&& ) = default;
 
 /**
  *  @brief Constructor
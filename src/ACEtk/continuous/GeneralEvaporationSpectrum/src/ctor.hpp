@@ -1,54 +1,10 @@
 GeneralEvaporationSpectrum() = default;
 
-GeneralEvaporationSpectrum( const GeneralEvaporationSpectrum& base ) :
-  Base( base ),
-  tabulated_( base.tabulated_ ), bins_( base.bins_ ) {
+GeneralEvaporationSpectrum( const GeneralEvaporationSpectrum& ) = default;
+GeneralEvaporationSpectrum( GeneralEvaporationSpectrum&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-GeneralEvaporationSpectrum( GeneralEvaporationSpectrum&& base ) :
-  Base( std::move( base ) ),
-  tabulated_( std::move( base.tabulated_ ) ), bins_( std::move( base.bins_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-GeneralEvaporationSpectrum& operator=( const GeneralEvaporationSpectrum& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->tabulated_ = base.tabulated_;
-    this->bins_ = base.bins_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-GeneralEvaporationSpectrum& operator=( GeneralEvaporationSpectrum&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->tabulated_ = std::move( base.tabulated_ );
-    this->bins_ = std::move( base.bins_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+GeneralEvaporationSpectrum& operator=( const GeneralEvaporationSpectrum& ) = default;
+GeneralEvaporationSpectrum& operator=( GeneralEvaporationSpectrum&& ) = default;
 
 /**
  *  @brief Constructor
@@ -1,58 +1,10 @@
 MultiDistributionData() = default;
 
-MultiDistributionData( const MultiDistributionData& base ) :
-  Base( base ), locb_( base.locb_ ),
-  probabilities_( base.probabilities_ ),
-  distributions_( base.distributions_ ) {
+MultiDistributionData( const MultiDistributionData& ) = default;
+MultiDistributionData( MultiDistributionData&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-MultiDistributionData( MultiDistributionData&& base ) :
-  Base( std::move( base ) ), locb_( base.locb_ ),
-  probabilities_( std::move( base.probabilities_ ) ),
-  distributions_( std::move( base.distributions_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-MultiDistributionData& operator=( const MultiDistributionData& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->locb_ = base.locb_;
-    this->probabilities_ = base.probabilities_;
-    this->distributions_ = base.distributions_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-MultiDistributionData& operator=( MultiDistributionData&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->locb_ = base.locb_;
-    this->probabilities_ = std::move( base.probabilities_ );
-    this->distributions_ = std::move( base.distributions_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+MultiDistributionData& operator=( const MultiDistributionData& ) = default;
+MultiDistributionData& operator=( MultiDistributionData&& ) = default;
 
 /**
  *  @brief Constructor
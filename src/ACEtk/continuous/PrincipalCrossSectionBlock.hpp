@@ -2,6 +2,10 @@
 #define NJOY_ACETK_CONTINUOUS_PRINCIPALCROSSSECTIONBLOCK
 
 // system includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 
 // other includes
 #include "ACEtk/base/ArrayData.hpp"
@@ -25,6 +29,12 @@ namespace continuous {
  */
 class PrincipalCrossSectionBlock : protected base::ArrayData {
 
+public:
+
+  #include "ACEtk/continuous/PrincipalCrossSectionBlock/EnergyGridIndex.hpp"
+
+private:
+
   /* fields */
 
   /* auxiliary functions */
@@ -71,6 +81,23 @@ public:
    */
   auto heating() const { return this->darray( 5 ); }
 
+  /**
+   *  @brief Return an index for fast lookups on the energy grid
+   *
+   *  The index refers to the energy values of this block, so this block must
+   *  outlive the index.
+   *
+   *  @param[in] bins   the number of lethargy bins (default: 8192)
+   */
+  EnergyGridIndex energyGridIndex( unsigned int bins = 8192 ) const {
+
+    auto energies = this->energies();
+    return EnergyGridIndex( energies.begin(), energies.end(), bins );
+  }
+
+  #include "ACEtk/continuous/PrincipalCrossSectionBlock/src/locate.hpp"
+  #include "ACEtk/continuous/PrincipalCrossSectionBlock/src/evaluate.hpp"
+
   using ArrayData::empty;
   using ArrayData::name;
   using ArrayData::length;
@@ -0,0 +1,56 @@
+/**
+ *  @class
+ *  @brief An index for fast lookups on the energy grid of the ESZ block
+ *
+ *  The energy range of the grid is divided into bins of equal lethargy width
+ *  (i.e. of equal width in ln(E)) and for each bin boundary, the index of
+ *  the last energy value that is smaller than or equal to that boundary is
+ *  stored. Looking up an energy value then consists of calculating its bin
+ *  and performing a binary search on the few energy values in that bin, so
+ *  that the lookup time does not depend on the size of the energy grid.
+ *
+ *  The index refers to the energy values of the block it was made for, so
+ *  the block (and the table it refers to) must outlive the index.
+ */
+class EnergyGridIndex {
+
+public:
+
+  /**
+   *  @class
+   *  @brief The location of an energy value on the energy grid
+   */
+  struct Location {
+
+    /** @brief The index of the interval (zero-based) */
+    std::size_t index;
+    /** @brief The interpolation fraction in the interval (between 0 and 1) */
+    double fraction;
+  };
+
+private:
+
+  /* fields */
+  Iterator begin_;
+  std::size_t size_;
+  double lower_;
+  double scale_;
+  std::vector< std::uint32_t > bins_;
+
+public:
+
+  /* constructor */
+  #include "ACEtk/continuous/PrincipalCrossSectionBlock/EnergyGridIndex/src/ctor.hpp"
+
+  /**
+   *  @brief Return the number of energy values on the grid
+   */
+  std::size_t size() const { return this->size_; }
+
+  /**
+   *  @brief Return the number of lethargy bins
+   */
+  std::size_t numberBins() const { return this->bins_.size() - 1; }
+
+  #include "ACEtk/continuous/PrincipalCrossSectionBlock/EnergyGridIndex/src/lookup.hpp"
+};
@@ -0,0 +1,42 @@
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] begin   the begin iterator of the energy values
+ *  @param[in] end     the end iterator of the energy values
+ *  @param[in] bins    the number of lethargy bins
+ */
+EnergyGridIndex( Iterator begin, Iterator end, unsigned int bins ) :
+  begin_( begin ), size_( std::distance( begin, end ) ),
+  lower_( 0. ), scale_( 0. ), bins_( std::max( 1u, bins ) + 1, 0 ) {
+
+  if ( this->size_ < 2 ) {
+
+    Log::error( "An energy grid index requires at least two energy values" );
+    Log::info( "Found {} energy values", this->size_ );
+    throw std::exception();
+  }
+  if ( *begin <= 0. ) {
+
+    Log::error( "An energy grid index requires strictly positive energy values" );
+    Log::info( "Found {} as the first energy value", *begin );
+    throw std::exception();
+  }
+
+  const std::size_t last = this->size_ - 1;
+  const std::size_t nbins = this->bins_.size() - 1;
+  const double upper = std::log( begin[ last ] );
+  this->lower_ = std::log( *begin );
+  this->scale_ = upper > this->lower_ ? nbins / ( upper - this->lower_ ) : 0.;
+
+  std::size_t index = 0;
+  for ( std::size_t bin = 1; bin <= nbins; ++bin ) {
+
+    const double boundary = std::exp( this->lower_ +
+                                      ( upper - this->lower_ ) * bin / nbins );
+    while ( ( index + 1 < last ) && ( begin[ index + 1 ] <= boundary ) ) {
+
+      ++index;
+    }
+    this->bins_[ bin ] = index;
+  }
+}
@@ -0,0 +1,47 @@
+/**
+ *  @brief Return the location of an energy value on the energy grid
+ *
+ *  The interval index is the index of the last energy value that is smaller
+ *  than or equal to the given energy value (so that at a discontinuity, the
+ *  interval above the discontinuity is used). Energy values outside of the
+ *  grid are clamped to the first or last interval, with a fraction of 0 or 1.
+ *
+ *  @param[in] energy   the energy value
+ */
+Location lookup( double energy ) const {
+
+  const std::size_t last = this->size_ - 1;
+  if ( energy <= this->begin_[0] ) {
+
+    return { 0, 0. };
+  }
+  if ( energy >= this->begin_[ last ] ) {
+
+    return { last - 1, 1. };
+  }
+
+  const std::size_t bin =
+      std::min( this->bins_.size() - 2,
+                static_cast< std::size_t >( ( std::log( energy ) - this->lower_ )
+                                            * this->scale_ ) );
+
+  // the bin boundaries are verified to guard against rounding in the
+  // calculation of the bin
+  std::size_t left = this->bins_[ bin ];
+  std::size_t right = this->bins_[ bin + 1 ] + 1;
+  while ( ( left > 0 ) && ( this->begin_[ left ] > energy ) ) {
+
+    --left;
+  }
+  while ( ( right < last ) && ( this->begin_[ right ] <= energy ) ) {
+
+    ++right;
+  }
+
+  const std::size_t index =
+      std::upper_bound( this->begin_ + left + 1, this->begin_ + right, energy )
+      - this->begin_ - 1;
+  const double lower = this->begin_[ index ];
+  const double upper = this->begin_[ index + 1 ];
+  return { index, ( energy - lower ) / ( upper - lower ) };
+}
@@ -0,0 +1,126 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+using Catch::Matchers::WithinAbs;
+
+// what we are testing
+#include "ACEtk/continuous/PrincipalCrossSectionBlock.hpp"
+
+// other includes
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+using PrincipalCrossSectionBlock = continuous::PrincipalCrossSectionBlock;
+using EnergyGridIndex = PrincipalCrossSectionBlock::EnergyGridIndex;
+
+PrincipalCrossSectionBlock makeBlock( std::vector< double > );
+
+SCENARIO( "EnergyGridIndex" ) {
+
+  GIVEN( "an ESZ block with a discontinuity in the energy grid" ) {
+
+    PrincipalCrossSectionBlock block =
+      makeBlock( { 1e-11, 1e-8, 2.53e-8, 1e-5, 1., 1., 2., 10., 20. } );
+
+    WHEN( "an index is made with the default number of bins" ) {
+
+      EnergyGridIndex index = block.energyGridIndex();
+
+      THEN( "energy values can be looked up" ) {
+
+        CHECK( 9 == index.size() );
+        CHECK( 8192 == index.numberBins() );
+
+        auto location = index.lookup( 1e-11 );
+        CHECK( 0 == location.index );
+        CHECK_THAT( 0., WithinAbs( location.fraction, 1e-15 ) );
+
+        location = index.lookup( 2e-8 );
+        CHECK( 1 == location.index );
+        CHECK_THAT( 10. / 15.3, WithinRel( location.fraction ) );
+
+        location = index.lookup( 2.53e-8 );
+        CHECK( 2 == location.index );
+        CHECK_THAT( 0., WithinAbs( location.fraction, 1e-15 ) );
+
+        location = index.lookup( 0.5 );
+        CHECK( 3 == location.index );
+
+        location = index.lookup( 1. );
+        CHECK( 5 == location.index );
+        CHECK_THAT( 0., WithinAbs( location.fraction, 1e-15 ) );
+
+        location = index.lookup( 1.5 );
+        CHECK( 5 == location.index );
+        CHECK_THAT( 0.5, WithinRel( location.fraction ) );
+
+        location = index.lookup( 15. );
+        CHECK( 7 == location.index );
+        CHECK_THAT( 0.5, WithinRel( location.fraction ) );
+
+        location = index.lookup( 20. );
+        CHECK( 7 == location.index );
+        CHECK_THAT( 1., WithinRel( location.fraction ) );
+      } // THEN
+
+      THEN( "energy values outside of the grid are clamped" ) {
+
+        auto location = index.lookup( 1e-12 );
+        CHECK( 0 == location.index );
+        CHECK_THAT( 0., WithinAbs( location.fraction, 1e-15 ) );
+
+        location = index.lookup( 30. );
+        CHECK( 7 == location.index );
+        CHECK_THAT( 1., WithinRel( location.fraction ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "indices are made with different numbers of bins" ) {
+
+      THEN( "the lookup agrees with a binary search over the energy grid" ) {
+
+        auto energies = block.energies();
+        for ( unsigned int bins : { 1u, 2u, 7u, 100u, 8192u } ) {
+
+          EnergyGridIndex index = block.energyGridIndex( bins );
+          CHECK( bins == index.numberBins() );
+          for ( double energy = 1.1e-11; energy < 20.; energy *= 1.01 ) {
+
+            auto expected = std::upper_bound( energies.begin(), energies.end(),
+                                              energy ) - energies.begin() - 1;
+            auto location = index.lookup( energy );
+            CHECK( expected == location.index );
+            CHECK( 0. <= location.fraction );
+            CHECK( location.fraction < 1. );
+          }
+          for ( double energy : energies ) {
+
+            auto location = index.lookup( energy );
+            CHECK( energy == energies[ location.index ] + location.fraction *
+                             ( energies[ location.index + 1 ] - energies[ location.index ] ) );
+          }
+        }
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data for an EnergyGridIndex instance" ) {
+
+    WHEN( "there are not enough or invalid energy values" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( makeBlock( { 1. } ).energyGridIndex() );
+        CHECK_THROWS( makeBlock( { 0., 1. } ).energyGridIndex() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+PrincipalCrossSectionBlock makeBlock( std::vector< double > energies ) {
+
+  std::vector< double > values( energies.size(), 1. );
+  return PrincipalCrossSectionBlock( std::move( energies ), values, values,
+                                     values, values );
+}
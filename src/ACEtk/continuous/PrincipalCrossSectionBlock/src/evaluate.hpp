@@ -0,0 +1,54 @@
+/**
+ *  @brief Evaluate the principal cross sections for a batch of energies
+ *
+ *  The cross sections and heating numbers are interpolated linearly on the
+ *  energy grid (lin-lin interpolation). The energies are located on the
+ *  grid in chunks and each array is then interpolated in a separate loop
+ *  over the chunk, which the compiler can vectorise. Energy values outside
+ *  of the grid are clamped to the first or last energy value.
+ *
+ *  An output array that is a null pointer is not evaluated.
+ *
+ *  @param[in]  index           the energy grid index of this block
+ *  @param[in]  energies        the energy values
+ *  @param[in]  size            the number of energy values
+ *  @param[out] total           the total cross section values
+ *  @param[out] elastic         the elastic cross section values
+ *  @param[out] disappearance   the disappearance cross section values
+ *  @param[out] heating         the average heating numbers
+ */
+void evaluate( const EnergyGridIndex& index,
+               const double* energies, std::size_t size,
+               double* total, double* elastic,
+               double* disappearance, double* heating ) const {
+
+  const double* arrays[4] = { &*this->total().begin(),
+                              &*this->elastic().begin(),
+                              &*this->disappearance().begin(),
+                              &*this->heating().begin() };
+  double* results[4] = { total, elastic, disappearance, heating };
+
+  constexpr std::size_t chunk = 256;
+  std::size_t indices[ chunk ];
+  double fractions[ chunk ];
+  for ( std::size_t start = 0; start < size; start += chunk ) {
+
+    const std::size_t length = std::min( chunk, size - start );
+    this->locate( index, energies + start, length, indices, fractions );
+
+    for ( unsigned int array = 0; array < 4; ++array ) {
+
+      if ( results[ array ] ) {
+
+        const double* values = arrays[ array ];
+        double* result = results[ array ] + start;
+        for ( std::size_t i = 0; i < length; ++i ) {
+
+          const double left = values[ indices[i] ];
+          const double right = values[ indices[i] + 1 ];
+          result[i] = left + fractions[i] * ( right - left );
+        }
+      }
+    }
+  }
+}
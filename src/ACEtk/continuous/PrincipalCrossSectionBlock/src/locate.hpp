@@ -0,0 +1,59 @@
+/**
+ *  @brief Return the location of an energy value on the energy grid
+ *
+ *  The location is found using a binary search on the energy grid and is
+ *  the same as the location given by an energy grid index (see
+ *  EnergyGridIndex::lookup). When many energy values need to be located,
+ *  an energy grid index should be used instead.
+ *
+ *  @param[in] energy   the energy value
+ */
+EnergyGridIndex::Location locate( double energy ) const {
+
+  const auto energies = this->energies();
+  const std::size_t last = energies.size() - 1;
+  if ( energy <= energies[0] ) {
+
+    return { 0, 0. };
+  }
+  if ( energy >= energies[ last ] ) {
+
+    return { last - 1, 1. };
+  }
+
+  const std::size_t index =
+      std::upper_bound( energies.begin(), energies.end(), energy )
+      - energies.begin() - 1;
+  const double lower = energies[ index ];
+  const double upper = energies[ index + 1 ];
+  return { index, ( energy - lower ) / ( upper - lower ) };
+}
+
+/**
+ *  @brief Locate a batch of energy values on the energy grid
+ *
+ *  @param[in]  index       the energy grid index of this block
+ *  @param[in]  energies    the energy values
+ *  @param[in]  size        the number of energy values
+ *  @param[out] intervals   the interval index for each energy value
+ *  @param[out] fractions   the interpolation fraction for each energy value
+ */
+void locate( const EnergyGridIndex& index,
+             const double* energies, std::size_t size,
+             std::size_t* intervals, double* fractions ) const {
+
+  if ( index.size() != this->NES() ) {
+
+    Log::error( "The energy grid index does not belong to the ESZ block" );
+    Log::info( "Number of energy values in the index: {}", index.size() );
+    Log::info( "Number of energy values in the ESZ block: {}", this->NES() );
+    throw std::exception();
+  }
+
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    const auto location = index.lookup( energies[i] );
+    intervals[i] = location.index;
+    fractions[i] = location.fraction;
+  }
+}
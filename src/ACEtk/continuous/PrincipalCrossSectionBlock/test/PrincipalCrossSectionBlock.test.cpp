@@ -240,6 +240,86 @@ SCENARIO( "PrincipalCrossSectionBlock" ) {
         verifyChunk( move, xss );
       } // THEN
     } // WHEN
+
+    WHEN( "the cross sections are evaluated for a batch of energies" ) {
+
+      PrincipalCrossSectionBlock chunk( xss.begin(), xss.end(), 99 );
+      auto index = chunk.energyGridIndex();
+
+      // the energy grid, the midpoints and values outside of the grid
+      std::vector< double > energies( chunk.energies().begin(),
+                                      chunk.energies().end() );
+      for ( unsigned int i = 0; i < 98; ++i ) {
+
+        energies.push_back( 0.5 * ( chunk.energies()[i] + chunk.energies()[i + 1] ) );
+      }
+      energies.push_back( 1e-12 );
+      energies.push_back( 30. );
+      const std::size_t size = energies.size();
+
+      std::vector< double > total( size ), elastic( size ),
+                            disappearance( size ), heating( size );
+      chunk.evaluate( index, energies.data(), size, total.data(),
+                      elastic.data(), disappearance.data(), heating.data() );
+
+      THEN( "the values are interpolated on the energy grid" ) {
+
+        auto interpolate = [] ( auto values, unsigned int i, double fraction ) {
+
+          return values[i] + fraction * ( values[i + 1] - values[i] );
+        };
+
+        for ( unsigned int i = 0; i < 99; ++i ) {
+
+          CHECK_THAT( chunk.total()[i], WithinRel( total[i] ) );
+          CHECK_THAT( chunk.elastic()[i], WithinRel( elastic[i] ) );
+          CHECK_THAT( chunk.disappearance()[i], WithinRel( disappearance[i] ) );
+          CHECK_THAT( chunk.heating()[i], WithinRel( heating[i] ) );
+        }
+        for ( unsigned int i = 0; i < 98; ++i ) {
+
+          CHECK_THAT( interpolate( chunk.total(), i, 0.5 ),
+                      WithinRel( total[99 + i] ) );
+          CHECK_THAT( interpolate( chunk.elastic(), i, 0.5 ),
+                      WithinRel( elastic[99 + i] ) );
+          CHECK_THAT( interpolate( chunk.disappearance(), i, 0.5 ),
+                      WithinRel( disappearance[99 + i] ) );
+          CHECK_THAT( interpolate( chunk.heating(), i, 0.5 ),
+                      WithinRel( heating[99 + i] ) );
+        }
+        CHECK_THAT( chunk.total().front(), WithinRel( total[197] ) );
+        CHECK_THAT( chunk.total().back(), WithinRel( total[198] ) );
+      } // THEN
+
+      THEN( "a binary search locates the energies like the index" ) {
+
+        for ( double energy : energies ) {
+
+          auto expected = index.lookup( energy );
+          auto location = chunk.locate( energy );
+          CHECK( expected.index == location.index );
+          CHECK( expected.fraction == location.fraction );
+        }
+      } // THEN
+
+      THEN( "null output arrays are not evaluated" ) {
+
+        std::vector< double > values( size, -1. );
+        chunk.evaluate( index, energies.data(), size, nullptr, values.data(),
+                        nullptr, nullptr );
+        CHECK( elastic == values );
+      } // THEN
+
+      THEN( "an exception is thrown when the index does not belong to the "
+            "block" ) {
+
+        PrincipalCrossSectionBlock other( { 1., 2. }, { 1., 1. }, { 1., 1. },
+                                          { 1., 1. }, { 1., 1. } );
+        CHECK_THROWS( chunk.evaluate( other.energyGridIndex(), energies.data(),
+                                      size, total.data(), nullptr, nullptr,
+                                      nullptr ) );
+      } // THEN
+    } // WHEN
   } // GIVEN
 } // SCENARIO
 
@@ -1,50 +1,10 @@
 ProbabilityTableBlock() = default;
 
-ProbabilityTableBlock( const ProbabilityTableBlock& base ) :
-  Base( base ), data_( base.data_ ) {
+ProbabilityTableBlock( const ProbabilityTableBlock& ) = default;
+ProbabilityTableBlock( ProbabilityTableBlock&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-ProbabilityTableBlock( ProbabilityTableBlock&& base ) :
-  Base( std::move( base ) ), data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-ProbabilityTableBlock& operator=( const ProbabilityTableBlock& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-ProbabilityTableBlock& operator=( ProbabilityTableBlock&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+ProbabilityTableBlock& operator=( const ProbabilityTableBlock& ) = default;
+ProbabilityTableBlock& operator=( ProbabilityTableBlock&& ) = default;
 
 /**
  *  @brief Constructor
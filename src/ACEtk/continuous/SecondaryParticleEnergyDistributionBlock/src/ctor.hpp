@@ -1,58 +1,10 @@
 SecondaryParticleEnergyDistributionBlock() = default;
 
-SecondaryParticleEnergyDistributionBlock(
-    const SecondaryParticleEnergyDistributionBlock& base ) :
-  BlockWithLocators( base ),
-  tyrh_( base.tyrh_ ),
-  frames_( base.frames_ ) {
-
-  if ( Base::owner() ) {
-
-    this->generateFrames();
-  }
-}
-
-SecondaryParticleEnergyDistributionBlock(
-    SecondaryParticleEnergyDistributionBlock&& base ) :
-  BlockWithLocators( std::move( base ) ),
-  tyrh_( std::move( base.tyrh_ ) ),
-  frames_( std::move( base.frames_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateFrames();
-  }
-}
+SecondaryParticleEnergyDistributionBlock( const SecondaryParticleEnergyDistributionBlock& ) = default;
+SecondaryParticleEnergyDistributionBlock( SecondaryParticleEnergyDistributionBlock&& ) = default;
 
-SecondaryParticleEnergyDistributionBlock& operator=( const SecondaryParticleEnergyDistributionBlock& base ) {
-
-  if ( this != &base ) {
-
-    BlockWithLocators::operator=( base );
-    this->tyrh_ = base.tyrh_;
-    this->frames_ = base.frames_;
-    if ( Base::owner() ) {
-
-      this->generateFrames();
-    }
-  }
-  return *this;
-}
-
-SecondaryParticleEnergyDistributionBlock& operator=( SecondaryParticleEnergyDistributionBlock&& base ) {
-
-  if ( this != &base ) {
-
-    BlockWithLocators::operator=( std::move( base ) );
-    this->tyrh_ = std::move( base.tyrh_ );
-    this->frames_ = std::move( base.frames_ );
-    if ( Base::owner() ) {
-
-      this->generateFrames();
-    }
-  }
-  return *this;
-}
+SecondaryParticleEnergyDistributionBlock& operator=( const SecondaryParticleEnergyDistributionBlock& ) = default;
+SecondaryParticleEnergyDistributionBlock& operator=( SecondaryParticleEnergyDistributionBlock&& ) = default;
 
 /**
  *  @brief Constructor (without reference frames for DLWH)
@@ -1,50 +1,10 @@
 TabulatedFissionMultiplicity() = default;
 
-TabulatedFissionMultiplicity( const TabulatedFissionMultiplicity& base ) :
-  Base( base ), data_( base.data_ ) {
+TabulatedFissionMultiplicity( const TabulatedFissionMultiplicity& ) = default;
+TabulatedFissionMultiplicity( TabulatedFissionMultiplicity&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-TabulatedFissionMultiplicity( TabulatedFissionMultiplicity&& base ) :
-  Base( std::move( base ) ), data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-TabulatedFissionMultiplicity& operator=( const TabulatedFissionMultiplicity& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-TabulatedFissionMultiplicity& operator=( TabulatedFissionMultiplicity&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+TabulatedFissionMultiplicity& operator=( const TabulatedFissionMultiplicity& ) = default;
+TabulatedFissionMultiplicity& operator=( TabulatedFissionMultiplicity&& ) = default;
 
 /**
  *  @brief Constructor
@@ -1,50 +1,10 @@
 TabulatedSecondaryParticleMultiplicity() = default;
 
-TabulatedSecondaryParticleMultiplicity( const TabulatedSecondaryParticleMultiplicity& base ) :
-  Base( base ), data_( base.data_ ) {
+TabulatedSecondaryParticleMultiplicity( const TabulatedSecondaryParticleMultiplicity& ) = default;
+TabulatedSecondaryParticleMultiplicity( TabulatedSecondaryParticleMultiplicity&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-TabulatedSecondaryParticleMultiplicity( TabulatedSecondaryParticleMultiplicity&& base ) :
-  Base( std::move( base ) ), data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-TabulatedSecondaryParticleMultiplicity& operator=( const TabulatedSecondaryParticleMultiplicity& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-TabulatedSecondaryParticleMultiplicity& operator=( TabulatedSecondaryParticleMultiplicity&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+TabulatedSecondaryParticleMultiplicity& operator=( const TabulatedSecondaryParticleMultiplicity& ) = default;
+TabulatedSecondaryParticleMultiplicity& operator=( TabulatedSecondaryParticleMultiplicity&& ) = default;
 
 /**
  *  @brief Constructor
@@ -0,0 +1,103 @@
+#ifndef NJOY_ACETK_FROMBINARYFILE
+#define NJOY_ACETK_FROMBINARYFILE
+
+// system includes
+#include <fstream>
+#include <string>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/BinaryFormat.hpp"
+#include "ACEtk/Table.hpp"
+#include "ACEtk/XsdirEntry.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+  /**
+   *  @brief Factory function to make an ACE table from a binary (type 2) file
+   *
+   *  @param[in] filename       the file name
+   *  @param[in] address        the record number of the table (default: 1)
+   *  @param[in] recordLength   the length of a record in bytes (default: 4096)
+   *  @param[in] entries        the number of entries per record (default: 512)
+   */
+  inline Table fromBinaryFile( const std::string& filename,
+                               unsigned int address = 1,
+                               unsigned int recordLength = 4096,
+                               unsigned int entries = 512 ) {
+
+    std::ifstream in( filename, std::ios::in | std::ios::binary );
+    if ( not in ) {
+
+      Log::error( "Could not open file \'{}\'", filename );
+      throw std::exception();
+    }
+
+    try {
+
+      return BinaryFormat::read( in, address, recordLength, entries );
+    }
+    catch ( std::exception& e ) {
+
+      Log::info( "Error while reading binary ACE file \'{}\'", filename );
+      throw e;
+    }
+  }
+
+  /**
+   *  @brief Factory function to make an ACE table from a binary (type 2) file
+   *         using the information in an xsdir entry
+   *
+   *  The access route of the entry (if any) is prepended to the file name.
+   *
+   *  @param[in] entry   the xsdir entry
+   */
+  inline Table fromBinaryFile( const XsdirEntry& entry ) {
+
+    if ( ( entry.fileType() != 2 ) || ( not entry.recordLength() ) ||
+         ( not entry.entriesPerRecord() ) ) {
+
+      Log::error( "The xsdir entry for \'{}\' does not describe a binary "
+                  "ACE table", entry.ZAID() );
+      Log::info( "File type: {}", entry.fileType() );
+      throw std::exception();
+    }
+
+    const std::string filename = entry.accessRoute()
+                                 ? *entry.accessRoute() + '/' + entry.fileName()
+                                 : entry.fileName();
+    return fromBinaryFile( filename, entry.address(),
+                           entry.recordLength().value(),
+                           entry.entriesPerRecord().value() );
+  }
+
+  /**
+   *  @brief Write an ACE table to a binary (type 2) file
+   *
+   *  @param[in] table          the ACE table
+   *  @param[in] filename       the file name
+   *  @param[in] recordLength   the length of a record in bytes (default: 4096)
+   *  @param[in] entries        the number of entries per record (default: 512)
+   *
+   *  @return the number of records that were written
+   */
+  inline std::size_t toBinaryFile( const Table& table,
+                                   const std::string& filename,
+                                   unsigned int recordLength = 4096,
+                                   unsigned int entries = 512 ) {
+
+    std::ofstream out( filename, std::ios::out | std::ios::binary );
+    if ( not out ) {
+
+      Log::error( "Could not open file \'{}\'", filename );
+      throw std::exception();
+    }
+
+    return BinaryFormat::write( table, out, recordLength, entries );
+  }
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
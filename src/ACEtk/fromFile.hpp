@@ -4,10 +4,15 @@
 // system includes
 #include <string>
 #include <fstream>
+#include <future>
+#include <iterator>
+#include <vector>
 
 // other includes
 #include "tools/Log.hpp"
+#include "ACEtk/FileIndex.hpp"
 #include "ACEtk/Table.hpp"
+#include "ACEtk/ThreadPool.hpp"
 
 namespace njoy {
 namespace ACEtk {
@@ -53,6 +58,26 @@ namespace ACEtk {
     return njoy::ACEtk::Table( state );
   }
 
+  /**
+   *  @brief Factory function to make an ACE table from a file using multiple
+   *         threads to decode the XSS array
+   *
+   *  If this function is applied to a concatenated ACE file, only the first
+   *  table is read.
+   *
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads to use
+   */
+  inline auto fromFile( const std::string& filename, unsigned int threads ) {
+
+    std::string content = readContentFromFile( filename );
+
+    using Iterator = decltype( content.cbegin() );
+    State< Iterator > state{ 1, content.cbegin(), content.cend() };
+
+    return njoy::ACEtk::Table( state, threads );
+  }
+
   /**
    *  @brief Factory function to make ACE tables from a concatenated file
    *
@@ -74,7 +99,127 @@ namespace ACEtk {
     return tables;
   }
 
-} // ENDFtk namespace
+  /**
+   *  @brief Parse ACE tables in a buffer concurrently
+   *
+   *  The tables are parsed concurrently on a thread pool and returned in the
+   *  order of the given table boundaries.
+   *
+   *  @tparam Iterator   a buffer iterator
+   *
+   *  @param[in] boundaries   the buffer states of the tables
+   *  @param[in] threads      the number of threads to use
+   */
+  template< typename Iterator >
+  std::vector< Table > readTables( const std::vector< State< Iterator > >& boundaries,
+                                   unsigned int threads ) {
+
+    ThreadPool pool( std::min( threads,
+                               static_cast< unsigned int >( boundaries.size() ) ) );
+    std::vector< std::future< Table > > futures;
+    futures.reserve( boundaries.size() );
+    for ( const auto& boundary : boundaries ) {
+
+      futures.emplace_back( pool.submit( [state = boundary] () mutable
+                                         { return Table( state ); } ) );
+    }
+
+    std::vector< Table > tables;
+    tables.reserve( futures.size() );
+    for ( auto& future : futures ) {
+
+      tables.emplace_back( future.get() );
+    }
+
+    return tables;
+  }
+
+  /**
+   *  @brief Read all ACE tables in a buffer concurrently
+   *
+   *  The boundaries of the tables are determined first using Table::skip
+   *  (which does not read the XSS arrays). The tables are then parsed
+   *  concurrently on a thread pool and returned in the order in which they
+   *  appear in the buffer.
+   *
+   *  @tparam Iterator   a buffer iterator
+   *
+   *  @param[in] state     the buffer state
+   *  @param[in] threads   the number of threads to use
+   */
+  template< typename Iterator >
+  std::vector< Table > readTables( State< Iterator >& state,
+                                   unsigned int threads ) {
+
+    // find the table boundaries
+    std::vector< State< Iterator > > boundaries;
+    while ( state.position != state.end ) {
+
+      const auto begin = state;
+      Table::skip( state );
+      boundaries.push_back( { begin.lineNumber, begin.position, state.position } );
+    }
+
+    return readTables( boundaries, threads );
+  }
+
+  /**
+   *  @brief Read all ACE tables in a buffer concurrently using a file index
+   *
+   *  The boundaries of the tables are taken from the index so the buffer
+   *  does not need to be scanned.
+   *
+   *  @tparam Iterator   a buffer iterator
+   *
+   *  @param[in] begin     the iterator to the start of the buffer
+   *  @param[in] index     the index of the file in the buffer
+   *  @param[in] threads   the number of threads to use
+   */
+  template< typename Iterator >
+  std::vector< Table > readTables( Iterator begin, const FileIndex& index,
+                                   unsigned int threads ) {
+
+    std::vector< State< Iterator > > boundaries;
+    boundaries.reserve( index.numberTables() );
+    for ( const auto& table : index.tables() ) {
+
+      boundaries.push_back( { table.summary.lineNumber(),
+                              std::next( begin, table.begin ),
+                              std::next( begin, table.end ) } );
+    }
+
+    return readTables( boundaries, threads );
+  }
+
+  /**
+   *  @brief Factory function to make ACE tables from a concatenated file
+   *         using multiple threads
+   *
+   *  When the file has a matching sidecar index (see FileIndex), the table
+   *  boundaries are taken from the index instead of scanning the file.
+   *
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads to use
+   */
+  inline auto fromConcatenatedFile( const std::string& filename,
+                                    unsigned int threads ) {
+
+    std::string content = readContentFromFile( filename );
+    if ( auto index = FileIndex::fromSidecar( filename ) ) {
+
+      if ( index->size() == content.size() ) {
+
+        return readTables( content.cbegin(), index.value(), threads );
+      }
+    }
+
+    using Iterator = decltype( content.cbegin() );
+    State< Iterator > state{ 1, content.cbegin(), content.cend() };
+
+    return readTables( state, threads );
+  }
+
+} // ACEtk namespace
 } // njoy namespace
 
 #endif
@@ -0,0 +1,108 @@
+#ifndef NJOY_ACETK_FROMMAPPEDFILE
+#define NJOY_ACETK_FROMMAPPEDFILE
+
+// system includes
+#include <string>
+#include <vector>
+
+// other includes
+#include "ACEtk/FileIndex.hpp"
+#include "ACEtk/MappedFile.hpp"
+#include "ACEtk/Table.hpp"
+#include "ACEtk/fromFile.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+  /**
+   *  @brief Factory function to make an ACE table from a memory mapped file
+   *
+   *  The file content is parsed directly from the memory mapping instead of
+   *  being copied into a string first. If this function is applied to a
+   *  concatenated ACE file, only the first table is read.
+   *
+   *  @param[in] filename   the file name
+   */
+  inline auto fromMappedFile( const std::string& filename ) {
+
+    MappedFile file( filename, MappedFile::Access::Sequential );
+    State< const char* > state{ 1, file.begin(), file.end() };
+
+    return njoy::ACEtk::Table( state );
+  }
+
+  /**
+   *  @brief Factory function to make an ACE table from a memory mapped file
+   *         using multiple threads to decode the XSS array
+   *
+   *  If this function is applied to a concatenated ACE file, only the first
+   *  table is read.
+   *
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads to use
+   */
+  inline auto fromMappedFile( const std::string& filename, unsigned int threads ) {
+
+    MappedFile file( filename );
+    State< const char* > state{ 1, file.begin(), file.end() };
+
+    return njoy::ACEtk::Table( state, threads );
+  }
+
+  /**
+   *  @brief Factory function to make ACE tables from a memory mapped
+   *         concatenated file
+   *
+   *  The file content is parsed directly from the memory mapping instead of
+   *  being copied into a string first. The pages of the file are released
+   *  as soon as a table has been read so that the resident memory remains
+   *  bounded by the size of the tables that were read.
+   *
+   *  @param[in] filename   the file name
+   */
+  inline auto fromMappedConcatenatedFile( const std::string& filename ) {
+
+    MappedFile file( filename, MappedFile::Access::Sequential );
+    State< const char* > state{ 1, file.begin(), file.end() };
+
+    std::vector< Table > tables;
+    while ( state.position != state.end ) {
+
+      tables.emplace_back( state );
+      file.release( state.position );
+    }
+
+    return tables;
+  }
+
+  /**
+   *  @brief Factory function to make ACE tables from a memory mapped
+   *         concatenated file using multiple threads
+   *
+   *  When the file has a matching sidecar index (see FileIndex), the table
+   *  boundaries are taken from the index instead of scanning the file.
+   *
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads to use
+   */
+  inline auto fromMappedConcatenatedFile( const std::string& filename,
+                                          unsigned int threads ) {
+
+    MappedFile file( filename );
+    if ( auto index = FileIndex::fromSidecar( filename ) ) {
+
+      if ( index->size() == file.size() ) {
+
+        return readTables( file.begin(), index.value(), threads );
+      }
+    }
+
+    State< const char* > state{ 1, file.begin(), file.end() };
+
+    return readTables( state, threads );
+  }
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
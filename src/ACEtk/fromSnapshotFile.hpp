@@ -0,0 +1,62 @@
+#ifndef NJOY_ACETK_FROMSNAPSHOTFILE
+#define NJOY_ACETK_FROMSNAPSHOTFILE
+
+// system includes
+#include <fstream>
+#include <string>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/MappedFile.hpp"
+#include "ACEtk/SnapshotFormat.hpp"
+#include "ACEtk/Table.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+  /**
+   *  @brief Factory function to make an ACE table from a snapshot file
+   *
+   *  The file is memory mapped and the XSS array is copied directly from
+   *  the mapping.
+   *
+   *  @param[in] filename   the file name
+   *  @param[in] verify     flag to verify the checksum (default: true)
+   */
+  inline Table fromSnapshotFile( const std::string& filename,
+                                 bool verify = true ) {
+
+    MappedFile file( filename );
+    try {
+
+      return SnapshotFormat::read( file.begin(), file.end(), verify );
+    }
+    catch ( std::exception& e ) {
+
+      Log::info( "Error while reading ACE table snapshot \'{}\'", filename );
+      throw e;
+    }
+  }
+
+  /**
+   *  @brief Write an ACE table to a snapshot file
+   *
+   *  @param[in] table      the ACE table
+   *  @param[in] filename   the file name
+   */
+  inline void toSnapshotFile( const Table& table, const std::string& filename ) {
+
+    std::ofstream out( filename, std::ios::out | std::ios::binary );
+    if ( not out ) {
+
+      Log::error( "Could not open file \'{}\'", filename );
+      throw std::exception();
+    }
+
+    SnapshotFormat::write( table, out );
+  }
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
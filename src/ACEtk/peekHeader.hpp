@@ -0,0 +1,71 @@
+#ifndef NJOY_ACETK_PEEKHEADER
+#define NJOY_ACETK_PEEKHEADER
+
+// system includes
+#include <string>
+#include <vector>
+
+// other includes
+#include "ACEtk/FileIndex.hpp"
+#include "ACEtk/MappedFile.hpp"
+#include "ACEtk/Table.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+  /**
+   *  @brief Factory function to read the summary of an ACE table from a file
+   *
+   *  The header, IZAW, NXS and JXS arrays of the table are read but the XSS
+   *  array is skipped. If this function is applied to a concatenated ACE
+   *  file, only the summary of the first table is read.
+   *
+   *  @param[in] filename   the file name
+   */
+  inline auto peekHeader( const std::string& filename ) {
+
+    MappedFile file( filename );
+    State< const char* > state{ 1, file.begin(), file.end() };
+
+    return Table::Summary( state );
+  }
+
+  /**
+   *  @brief Factory function to read the summaries of the ACE tables in a
+   *         concatenated file
+   *
+   *  The XSS arrays are skipped based on their length in the NXS array so
+   *  that only the lines at the start of each table are actually read. When
+   *  the file has a matching sidecar index (see FileIndex), the summaries are
+   *  taken from the index instead.
+   *
+   *  @param[in] filename   the file name
+   */
+  inline auto peekConcatenatedFile( const std::string& filename ) {
+
+    std::vector< Table::Summary > summaries;
+    if ( auto index = FileIndex::fromSidecar( filename ) ) {
+
+      for ( const auto& table : index->tables() ) {
+
+        summaries.push_back( table.summary );
+      }
+      return summaries;
+    }
+
+    MappedFile file( filename );
+    State< const char* > state{ 1, file.begin(), file.end() };
+
+    while ( state.position != state.end ) {
+
+      summaries.emplace_back( state );
+      file.release( state.position );
+    }
+
+    return summaries;
+  }
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
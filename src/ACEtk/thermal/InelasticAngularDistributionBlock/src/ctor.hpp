@@ -22,67 +22,11 @@ public:
 
 InelasticAngularDistributionBlock() = default;
 
-InelasticAngularDistributionBlock( const InelasticAngularDistributionBlock& base ) :
-  Base( base ), ifeng_( base.ifeng_ ),
-  nc_( base.nc_ ), nieb_( base.nieb_ ), ne_( base.ne_ ),
-  locb_( base.locb_ ), data_( base.data_ ) {
+InelasticAngularDistributionBlock( const InelasticAngularDistributionBlock& ) = default;
+InelasticAngularDistributionBlock( InelasticAngularDistributionBlock&& ) = default;
 
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-InelasticAngularDistributionBlock( InelasticAngularDistributionBlock&& base ) :
-  Base( std::move( base ) ), ifeng_( base.ifeng_ ),
-  nc_( base.nc_ ), nieb_( base.nieb_ ), ne_( base.ne_ ),
-  locb_( base.locb_ ), data_( std::move( base.data_ ) ) {
-
-  if ( Base::owner() ) {
-
-    this->generateBlocks();
-  }
-}
-
-InelasticAngularDistributionBlock&
-operator=( const InelasticAngularDistributionBlock& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( base );
-    this->ifeng_ = base.ifeng_;
-    this->nc_ = base.nc_;
-    this->nieb_ = base.nieb_;
-    this->ne_ = base.ne_;
-    this->locb_ = base.locb_;
-    this->data_ = base.data_;
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
-
-InelasticAngularDistributionBlock&
-operator=( InelasticAngularDistributionBlock&& base ) {
-
-  if ( this != &base ) {
-
-    Base::operator=( std::move( base ) );
-    this->ifeng_ = base.ifeng_;
-    this->nc_ = base.nc_;
-    this->nieb_ = std::move( base.nieb_ );
-    this->ne_ = base.ne_;
-    this->locb_ = base.locb_;
-    this->data_ = std::move( base.data_ );
-    if ( Base::owner() ) {
-
-      this->generateBlocks();
-    }
-  }
-  return *this;
-}
+InelasticAngularDistributionBlock& operator=( const InelasticAngularDistributionBlock& ) = default;
+InelasticAngularDistributionBlock& operator=( InelasticAngularDistributionBlock&& ) = default;
 
 /**
  *  @brief Constructor
@@ -0,0 +1,192 @@
+#ifndef NJOY_ACETK_TOCONCATENATEDFILE
+#define NJOY_ACETK_TOCONCATENATEDFILE
+
+// system includes
+#include <algorithm>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// other includes
+#include "tools/Log.hpp"
+#include "ACEtk/Table.hpp"
+#include "ACEtk/ThreadPool.hpp"
+#include "ACEtk/XsdirEntry.hpp"
+
+namespace njoy {
+namespace ACEtk {
+
+  /**
+   *  @brief Write a sequence of ACE tables to a concatenated (type 1) file
+   *
+   *  The tables are formatted concurrently (one table per thread) but they
+   *  are written to the file in the order of the sequence. At most one
+   *  formatted table per thread is kept in memory at any given time. The
+   *  starting line of each table is tracked while writing so that the xsdir
+   *  entries for the file are available without reading it back.
+   *
+   *  When input iterators are used (e.g. the iterators of a TableReader), the
+   *  tables that are being formatted are copied so that a concatenated file
+   *  can be filtered or transformed while streaming it from one file to
+   *  another.
+   *
+   *  The file name in the xsdir entries is relative to the datapath of the
+   *  xsdir. When no datapath is given, the directory of the file is assumed
+   *  to be the datapath. The ptable flag of the entries is set for continuous
+   *  energy tables with probability tables for the unresolved resonance range.
+   *
+   *  @param[in] first      the iterator to the first table
+   *  @param[in] last       the iterator past the last table
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads to use (default: 1)
+   *  @param[in] datapath   the datapath of the xsdir (default: the directory
+   *                        of the file)
+   *
+   *  @return the xsdir entries of the tables, in the order of the file
+   */
+  template< typename Iterator >
+  std::vector< XsdirEntry > toConcatenatedFile( Iterator first, Iterator last,
+                                                const std::string& filename,
+                                                unsigned int threads = 1,
+                                                const std::string& datapath = "" ) {
+
+    std::ofstream out( filename, std::ios::out | std::ios::binary );
+    if ( not out ) {
+
+      Log::error( "Could not open file \'{}\'", filename );
+      throw std::exception();
+    }
+
+    auto format = [] ( const Table& table ) {
+
+      std::ostringstream buffer;
+      table.print( buffer );
+      return buffer.str();
+    };
+
+    // the file name relative to the datapath
+    namespace fs = std::filesystem;
+    std::string name = fs::path( filename ).filename().generic_string();
+    if ( not datapath.empty() ) {
+
+      const auto relative =
+          fs::absolute( filename ).lexically_normal().lexically_relative(
+              fs::absolute( datapath ).lexically_normal() );
+      name = relative.empty() ? filename : relative.generic_string();
+    }
+
+    std::vector< XsdirEntry > entries;
+    unsigned int address = 1;
+    auto write = [&] ( const Table& table, const std::string& content ) {
+
+      out.write( content.data(), content.size() );
+      if ( not out ) {
+
+        Log::error( "Could not write to file \'{}\'", filename );
+        throw std::exception();
+      }
+
+      std::visit( [&] ( const auto& header ) {
+
+                    unsigned int length = table.data().XSS().size();
+                    std::optional< double > temperature = header.TEMP();
+                    entries.emplace_back( header.ZAID(), header.AWR(), name,
+                                          address, length, temperature,
+                                          table.ptable() );
+                  },
+                  table.header() );
+      address += std::count( content.begin(), content.end(), '\n' );
+    };
+
+    threads = std::max( 1u, threads );
+    if ( threads == 1 ) {
+
+      for ( ; first != last; ++first ) {
+
+        write( *first, format( *first ) );
+      }
+    }
+    else {
+
+      // formatting runs at most one table per thread ahead of writing
+      // (tables from a single pass input iterator are copied since they are
+      // no longer available once the iterator is incremented)
+      using Category = typename std::iterator_traits< Iterator >::iterator_category;
+      constexpr bool forward = std::is_base_of_v< std::forward_iterator_tag, Category >;
+
+      struct Pending {
+
+        std::optional< Table > copy;
+        const Table* table = nullptr;
+        std::future< std::string > content;
+      };
+
+      // references to the elements of a deque remain valid when elements are
+      // added at the back or removed from the front (the pool is declared
+      // last so that its workers are joined before the copies are destroyed)
+      std::deque< Pending > pending;
+      ThreadPool pool( threads );
+      auto submit = [&pool, &format] ( const Table& table ) {
+
+        return pool.submit( [&format, &table] { return format( table ); } );
+      };
+
+      for ( ; first != last; ++first ) {
+
+        if ( pending.size() == threads ) {
+
+          write( *pending.front().table, pending.front().content.get() );
+          pending.pop_front();
+        }
+        auto& current = pending.emplace_back();
+        if constexpr ( forward ) {
+
+          current.table = &*first;
+        }
+        else {
+
+          current.table = &current.copy.emplace( *first );
+        }
+        current.content = submit( *current.table );
+      }
+      for ( ; not pending.empty(); pending.pop_front() ) {
+
+        write( *pending.front().table, pending.front().content.get() );
+      }
+    }
+
+    return entries;
+  }
+
+  /**
+   *  @brief Write ACE tables to a concatenated (type 1) file
+   *
+   *  @param[in] tables     the ACE tables
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads to use (default: 1)
+   *  @param[in] datapath   the datapath of the xsdir (default: the directory
+   *                        of the file)
+   *
+   *  @return the xsdir entries of the tables, in the order of the file
+   */
+  inline std::vector< XsdirEntry >
+  toConcatenatedFile( const std::vector< Table >& tables,
+                      const std::string& filename,
+                      unsigned int threads = 1,
+                      const std::string& datapath = "" ) {
+
+    return toConcatenatedFile( tables.begin(), tables.end(), filename, threads,
+                               datapath );
+  }
+
+} // ACEtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,223 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ACEtk/toConcatenatedFile.hpp"
+
+// other includes
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "ACEtk/fromFile.hpp"
+#include "ACEtk/peekHeader.hpp"
+
+// convenience typedefs
+using namespace njoy::ACEtk;
+
+std::string chunk();
+std::string chunkWith201Header();
+void writeFile( const std::string&, const std::string& );
+std::string readFile( const std::string& );
+void verifyEntries( const std::vector< XsdirEntry >&, const std::string& );
+
+SCENARIO( "toConcatenatedFile" ) {
+
+  GIVEN( "a sequence of ACE tables" ) {
+
+    std::string string = chunk() + chunkWith201Header() + chunk() +
+                         chunkWith201Header() + chunk();
+    writeFile( "original.ace", string );
+    std::vector< Table > tables = fromConcatenatedFile( "original.ace" );
+
+    WHEN( "the tables are written to a concatenated file" ) {
+
+      auto entries = toConcatenatedFile( tables, "sequential.ace" );
+
+      THEN( "the file is identical and the xsdir entries are correct" ) {
+
+        CHECK( string == readFile( "sequential.ace" ) );
+        verifyEntries( entries, "sequential.ace" );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the tables are written to a concatenated file using threads" ) {
+
+      auto two = toConcatenatedFile( tables, "two.ace", 2 );
+      auto many = toConcatenatedFile( tables.begin(), tables.end(),
+                                      "many.ace", 8 );
+
+      THEN( "the file is identical and the xsdir entries are correct" ) {
+
+        CHECK( string == readFile( "two.ace" ) );
+        CHECK( string == readFile( "many.ace" ) );
+        verifyEntries( two, "two.ace" );
+        verifyEntries( many, "many.ace" );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the xsdir entries are printed" ) {
+
+      auto entries = toConcatenatedFile( tables.begin(), tables.begin() + 2,
+                                         "xsdir.ace" );
+      std::ostringstream out;
+      entries[1].print( out );
+
+      THEN( "the entry refers to the table in the file" ) {
+
+        CHECK( "92238.800nc   236.005800 xsdir.ace 0 1 15 6 0 0 2.530100e-08 ptable\n"
+               == out.str() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the tables are written to a file in a subdirectory" ) {
+
+      std::filesystem::create_directories( "library/neutron" );
+      auto local = toConcatenatedFile( tables, "library/neutron/local.ace" );
+      auto relative = toConcatenatedFile( tables, "library/neutron/relative.ace",
+                                          2, "library" );
+      auto current = toConcatenatedFile( tables, "library/neutron/current.ace",
+                                         1, "./" );
+
+      THEN( "the file names are relative to the datapath" ) {
+
+        CHECK( "local.ace" == local[0].fileName() );
+        CHECK( "neutron/relative.ace" == relative[0].fileName() );
+        CHECK( "library/neutron/current.ace" == current[0].fileName() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "ACE tables without probability tables" ) {
+
+    // a continuous energy table without an UNR block and a table of another type
+    std::string string = chunk();
+    string.replace( string.find( "1464171" ), 7, "      0" );
+    std::string other = chunk();
+    other.replace( other.find( "92238.80c" ), 9, "92238.80y" );
+    writeFile( "other.ace", string + other );
+    std::vector< Table > tables = fromConcatenatedFile( "other.ace" );
+
+    WHEN( "the tables are written to a concatenated file" ) {
+
+      auto entries = toConcatenatedFile( tables, "noptable.ace" );
+
+      THEN( "the ptable flag is not set" ) {
+
+        CHECK( 2 == entries.size() );
+        CHECK( false == entries[0].ptable() );
+        CHECK( false == entries[1].ptable() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an empty sequence of ACE tables" ) {
+
+    std::vector< Table > tables;
+
+    WHEN( "the tables are written to a concatenated file" ) {
+
+      auto entries = toConcatenatedFile( tables, "empty.ace", 2 );
+
+      THEN( "the file is empty and there are no xsdir entries" ) {
+
+        CHECK( 0 == entries.size() );
+        CHECK( "" == readFile( "empty.ace" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data" ) {
+
+    std::vector< Table > tables;
+
+    WHEN( "the file cannot be opened" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( toConcatenatedFile( tables, "not-a-directory/file.ace" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+void writeFile( const std::string& filename, const std::string& content ) {
+
+  std::ofstream out( filename, std::ios::binary );
+  out << content;
+}
+
+std::string readFile( const std::string& filename ) {
+
+  std::ifstream in( filename, std::ios::binary );
+  return std::string( std::istreambuf_iterator< char >( in ), {} );
+}
+
+void verifyEntries( const std::vector< XsdirEntry >& entries,
+                    const std::string& filename ) {
+
+  auto summaries = peekConcatenatedFile( filename );
+
+  CHECK( 5 == entries.size() );
+  CHECK( 5 == summaries.size() );
+  for ( unsigned int i = 0; i < entries.size(); ++i ) {
+
+    CHECK( summaries[i].ZAID() == entries[i].ZAID() );
+    CHECK_THAT( summaries[i].AWR(), WithinRel( entries[i].AWR() ) );
+    CHECK( filename == entries[i].fileName() );
+    CHECK( 1 == entries[i].fileType() );
+    CHECK( summaries[i].lineNumber() == entries[i].address() );
+    CHECK( summaries[i].length() == entries[i].tableLength() );
+    CHECK( std::nullopt == entries[i].accessRoute() );
+    CHECK( summaries[i].ptable() == entries[i].ptable() );
+    CHECK( true == entries[i].ptable() );
+    CHECK_THAT( summaries[i].TEMP(), WithinRel( entries[i].temperature().value() ) );
+  }
+
+  CHECK( 1 == entries[0].address() );
+  CHECK( 15 == entries[1].address() );
+  CHECK( 31 == entries[2].address() );
+  CHECK( 45 == entries[3].address() );
+  CHECK( 61 == entries[4].address() );
+}
+
+std::string chunk() {
+
+  return
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}
+
+std::string chunkWith201Header() {
+
+  return
+    "2.0.1                   92238.800nc            ENDF/B-VIII.0\n"
+    "  236.005800   2.5301E-08 2018-05-01          2\n"
+    " 92238.80c  236.005800  2.5301E-08   12/13/12\n"
+    "U238 ENDF71x (jlconlin)  Ref. see jlconlin (ref 09/10/2012  10:00:53)    mat9237\n"
+    "      0 15.0000000      1 14.0000000      2 13.0000000      3 12.0000000\n"
+    "      4 11.0000000      5 10.0000000      6  9.0000000      7  8.0000000\n"
+    "      8  7.0000000      9  6.0000000     10  5.0000000     11  4.0000000\n"
+    "     12  3.0000000     13  2.0000000     14  1.0000000     15  0.0000000\n"
+    "        6    33074     1595      132       46      814        2        0\n"
+    "        0        0        0        0        0        0        0        9\n"
+    "        1   788721   788768   788815   788862   788909   788956  1270743\n"
+    "  1270789  1363882  1363927  1475750  1633494  1633500  1633506  1634036\n"
+    "  1634042  1634042  1634048  1637218   789147  1637220  1464171  1465923\n"
+    "  1465934  1465976  1465982        0        0        0        0        8\n"
+    "  1.000000000000E+00  1.031250000000E+00  1.062500000000E+00  1.093750000000E+00\n"
+    "  1.125000000000E+00  1.156250000000E+00\n";
+}